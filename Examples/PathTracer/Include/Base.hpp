@@ -30,6 +30,7 @@ namespace PathTracer
     using Plane = Math::Geometry::Plane<f32>;
     using Triangle = Math::Geometry::Triangle<f32>;
     using Sphere = Math::Geometry::Sphere<f32>;
+    using Box = Math::Geometry::Box<f32>;
 }
 
 #endif //MATHLIB_EXAMPLES_PATHTRACER_BASE_HPP
@@ -24,6 +24,7 @@ namespace PathTracer
             virtual LightSample Sample(RNG& rng, const Point3f& distantPoint) const = 0;
             virtual Vector3f Evaluate(const Point3f& distantPoint, const Point3f& lightPoint) const = 0;
             virtual f32 PDF(const Point3f& distantPoint, const Point3f& lightPoint) const = 0;
+            virtual f32 Power() const = 0;
             virtual ~GenericLight() {}
         };
 
@@ -49,6 +50,11 @@ namespace PathTracer
             {
                 return mLight.PDF(distantPoint, lightPoint);
             }
+
+            f32 Power() const override
+            {
+                return mLight.Power();
+            }
         private:
             LightType mLight;
         };
@@ -72,6 +78,11 @@ namespace PathTracer
         {
             return mLight->PDF(distantPoint, lightPoint);
         }
+
+        f32 Power() const
+        {
+            return mLight->Power();
+        }
     private:
         std::unique_ptr<GenericLight> mLight;
     };
@@ -85,6 +96,7 @@ namespace PathTracer
 
         Vector3f Evaluate(const Point3f& distantPoint, const Point3f& lightPoint) const;
         f32 PDF(const Point3f& distantPoint, const Point3f& lightPoint) const;
+        f32 Power() const;
     private:
         Point3f  mPosition;
         Vector3f mEmission;
@@ -99,6 +111,7 @@ namespace PathTracer
 
         Vector3f Evaluate(const Point3f& distantPoint, const Point3f& lightPoint) const;
         f32 PDF(const Point3f& distantPoint, const Point3f& lightPoint) const;
+        f32 Power() const;
     private:
         Sphere mSphere;
         Vector3f mEmission;
@@ -21,8 +21,14 @@ namespace PathTracer
 
             f32 Distance;
             Vector3f Normal;
-            const Material* Material;
-            const Light* Light;
+            const PathTracer::Material* Material;
+            const PathTracer::Light* Light;
+        };
+
+        struct LightSelection
+        {
+            const PathTracer::Light* Light;
+            f32 Probability;
         };
 
         class Object
@@ -42,6 +48,7 @@ namespace PathTracer
             public:
                 virtual Intersection Intersect(const Ray& ray, const Interval& interval) const noexcept = 0;
                 virtual bool HasIntersection(const Ray& ray, const Interval& interval) const noexcept = 0;
+                virtual Box Bounds() const noexcept = 0;
                 virtual ~GenericObject() noexcept {}
             };
 
@@ -66,7 +73,12 @@ namespace PathTracer
 
                 bool HasIntersection(const Ray& ray, const Interval& interval) const noexcept override
                 {
-                    return Math::Geometry::NearestIntersection(ray, interval, mObject).IsValid();
+                    return Math::Geometry::AnyIntersection(ray, interval, mObject);
+                }
+
+                Box Bounds() const noexcept override
+                {
+                    return Math::Geometry::BoundingBox(mObject);
                 }
             private:
                 ObjectType mObject;
@@ -79,6 +91,7 @@ namespace PathTracer
 
             Intersection Intersect(const Ray& ray, const Interval& interval) const noexcept;
             bool HasIntersection(const Ray& ray, const Interval& interval) const noexcept;
+            Box Bounds() const noexcept;
         private:
             // Note(3011): It might make sense to replace this
             // with a small buffer that can store the objects directly
@@ -98,11 +111,20 @@ namespace PathTracer
 
         const Camera& GetCamera() const;
         std::span<const Light> GetLights() const;
+
+        LightSelection SampleLight(RNG& rng) const;
+        f32 LightProbability(const Light& light) const;
     private:
         Camera mCamera;
         std::vector<Object> mObjects;
+        // Note(3011): Over the bounds of mObjects, the planes end up in its
+        // list of unbounded primitives.
+        Math::Geometry::BVH<f32> mBVH;
         std::vector<Light> mLights;
         std::vector<Material> mMaterials;
+        // Note(3011): Lights are picked proportionally to their power, so only
+        // a single shadow ray is needed per bounce regardless of the light count.
+        Math::DiscreteDistribution<f32> mLightSelection;
     };
 }
 
@@ -85,16 +85,18 @@ int main(int argc, char **argv)
 
                             PathTracer::Vector3f mis(0.0f);
                             {   // Explicit lightsource sampling
-                                for (const auto& light : scene.GetLights())
+                                PathTracer::Scene::LightSelection selection = scene.SampleLight(rng);
+                                if (selection.Light)
                                 {
-                                    PathTracer::LightSample sample = light.Sample(rng, intersectedPoint);
+                                    PathTracer::LightSample sample = selection.Light->Sample(rng, intersectedPoint);
                                     PathTracer::Ray lightRay(intersectedPoint, sample.OutgoingDirection);
                                     PathTracer::Vector3f outgoingDirection = intersectedBase * sample.OutgoingDirection;
                                     f32 cosTheta = Math::Dot(intersection.Normal, lightRay.Direction);
+                                    f32 lightPdf = sample.PDF * selection.Probability;
                                     f32 brdfPdf = Math::Equal(sample.PDF, 1.0f) ? 0.0f : intersection.Material->PDF(incomingDirection, outgoingDirection);
                                     if (cosTheta > 0.0f && sample.Intensity.Max() > 0.0f && !scene.HasIntersection(lightRay, {Math::Constant::GeometryEpsilon<f32>, sample.Distance - 2.0f * Math::Constant::GeometryEpsilon<f32>}))
                                     {
-                                        mis += (intersection.Material->BRDF(incomingDirection, outgoingDirection) * sample.Intensity * cosTheta) / (sample.PDF + brdfPdf);
+                                        mis += (intersection.Material->BRDF(incomingDirection, outgoingDirection) * sample.Intensity * cosTheta) / (lightPdf + brdfPdf);
                                     }
                                 }
                             }
@@ -109,7 +111,8 @@ int main(int argc, char **argv)
                                 if (intersection.Light && cosTheta > 0.0f && sample.Intensity.Max() > 0.0f)
                                 {
                                     PathTracer::Point3f lightPoint = ray.Project(intersection.Distance);
-                                    mis += sample.Intensity * intersection.Light->Evaluate(intersectedPoint, lightPoint) * cosTheta / (sample.PDF + intersection.Light->PDF(intersectedPoint, lightPoint));
+                                    f32 lightPdf = intersection.Light->PDF(intersectedPoint, lightPoint) * scene.LightProbability(*intersection.Light);
+                                    mis += sample.Intensity * intersection.Light->Evaluate(intersectedPoint, lightPoint) * cosTheta / (sample.PDF + lightPdf);
                                 }
 
                                 accumulator += throughput * mis;
@@ -1,5 +1,6 @@
 #include "Light.hpp"
-#include "Sampling.hpp"
+
+#include <Math/Sampling.hpp>
 
 namespace PathTracer
 {
@@ -28,6 +29,11 @@ namespace PathTracer
         return 1.0f;
     }
 
+    f32 PointLight::Power() const
+    {
+        return mEmission.Max();
+    }
+
 
     SphericalLight::SphericalLight(const Sphere& sphere, const Vector3f& emission)
         : mSphere(sphere), mEmission(emission)
@@ -36,7 +42,10 @@ namespace PathTracer
     LightSample SphericalLight::Sample(RNG& rng, const Point3f& distantPoint) const
     {
         // Note(3011): This is the most naive sampling, it's incredibly ineffective, should be replaced later.
-        Point3f lightPoint = SampleSphere(rng, mSphere);
+        Uniform dist;
+        f32 u = dist(rng);
+        f32 v = dist(rng);
+        Point3f lightPoint = Math::Sampling::UniformSphere(mSphere, Vector2f(u, v)).Value;
         Vector3f direction = lightPoint - distantPoint;
         Vector3f normal = mSphere.SurfaceNormal(lightPoint);
         f32 lambert = Math::Dot(normal, Math::Normalize(direction));
@@ -57,4 +66,9 @@ namespace PathTracer
     {
         return 1.0f / (4.0f * Math::Constant::Pi<f32> * Math::Squared(mSphere.Radius));
     }
+
+    f32 SphericalLight::Power() const
+    {
+        return mEmission.Max() * 4.0f * Math::Constant::Pi<f32> * Math::Squared(mSphere.Radius);
+    }
 }
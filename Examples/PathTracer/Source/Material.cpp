@@ -1,5 +1,6 @@
 #include "Material.hpp"
-#include "Sampling.hpp"
+
+#include <Math/Sampling.hpp>
 
 namespace PathTracer
 {
@@ -9,11 +10,14 @@ namespace PathTracer
 
     MaterialSample Material::Sample(RNG& rng, const Vector3f& incomingDirection) const
     {
-        Vector3f outgoingDirection = Vector3f(SampleHemisphereCosWeighted(rng));
+        Uniform dist;
+        f32 u = dist(rng);
+        f32 v = dist(rng);
+        Math::Sampling::Sample<Vector3f, f32> sample = Math::Sampling::CosineHemisphere(Vector2f(u, v));
         return {
-            .OutgoingDirection = outgoingDirection,
-            .Intensity = BRDF(incomingDirection, outgoingDirection),
-            .PDF = PDF(incomingDirection, outgoingDirection)
+            .OutgoingDirection = sample.Value,
+            .Intensity = BRDF(incomingDirection, sample.Value),
+            .PDF = sample.PDF
         };
     }
 
@@ -22,9 +26,8 @@ namespace PathTracer
         return mReflectance / Math::Constant::Pi<f32>;
     }
 
-    f32 Material::PDF(const Vector3f& incomingDirection, const Vector3f& outgingDirection) const
+    f32 Material::PDF([[maybe_unused]] const Vector3f& incomingDirection, const Vector3f& outgoingDirection) const
     {
-        // TODO(3011): Not sure if this is completely correct.
-        return 1.0f / Math::Constant::Pi<f32>;
+        return Math::Sampling::CosineHemispherePDF(outgoingDirection.z);
     }
 }
@@ -28,6 +28,11 @@ namespace PathTracer
         return mObject->HasIntersection(ray, interval);
     }
 
+    Box Scene::Object::Bounds() const noexcept
+    {
+        return mObject->Bounds();
+    }
+
     Scene::Scene(const Vector2sz& resolution)
         : mCamera({0.0f, 0.5f, -2.0f}, {0.0f, 0.0f, 1.0f}, resolution, Math::ToRadians<f32>(90.0f)),
           mObjects{},
@@ -49,21 +54,40 @@ namespace PathTracer
         // (Spherical) Area light.
         mObjects.push_back({Sphere({{0.8f, 0.8f, 0.0f}, 0.2f}), 1000});
         mLights.push_back({SphericalLight({{0.8f, 0.8f, 0.0f}, 0.2f}, Vector3f(15.0f))});
+
+        std::vector<f32> lightPowers;
+        for (const auto& light : mLights)
+        {
+            lightPowers.push_back(light.Power());
+        }
+        mLightSelection.Rebuild(lightPowers);
+
+        std::vector<Box> bounds;
+        for (const auto& object : mObjects)
+        {
+            bounds.push_back(object.Bounds());
+        }
+        mBVH = Math::Geometry::BVH<f32>(std::span<const Box>(bounds));
     }
 
     Scene::Intersection Scene::Intersect(const Ray& ray, const Interval& interval) const
     {
-        Object::Intersection nearest = mObjects[0].Intersect(ray, interval);
-        SizeType nearestIndex = 0;
-
-        for (SizeType i = 1; i < mObjects.size(); ++i)
+        // Note(3011): The BVH only asks for hits nearer than the nearest one
+        // so far, every valid candidate replaces it.
+        Object::Intersection nearest{ .Distance = f32::NaN(), .Normal = Vector3f(0.0f), .MaterialIndex = 0 };
+        auto hit = mBVH.NearestIntersection(ray, interval, [this, &nearest](SizeType index, const Ray& r, const Interval& i)
         {
-            Object::Intersection candidate = mObjects[Math::ToUnderlying(i)].Intersect(ray, interval);
-            if (!nearest.IsValid() || nearest.Distance > candidate.Distance)
+            Object::Intersection candidate = mObjects[Math::ToUnderlying(index)].Intersect(r, i);
+            if (candidate.IsValid())
             {
                 nearest = candidate;
-                nearestIndex = i;
             }
+            return Math::Geometry::Intersection<f32>(candidate.Distance);
+        });
+
+        if (!hit)
+        {
+            return { .Distance = f32::NaN(), .Normal = Vector3f(0.0f), .Material = nullptr, .Light = nullptr };
         }
 
         return {
@@ -76,15 +100,10 @@ namespace PathTracer
 
     bool Scene::HasIntersection(const Ray& ray, const Interval& interval) const
     {
-        for (const auto& object : mObjects)
+        return mBVH.HasIntersection(ray, interval, [this](SizeType index, const Ray& r, const Interval& i)
         {
-            if (object.HasIntersection(ray, interval))
-            {
-                return true;
-            }
-        }
-
-        return false;
+            return mObjects[Math::ToUnderlying(index)].HasIntersection(r, i);
+        });
     }
 
     const Camera& Scene::GetCamera() const
@@ -96,4 +115,20 @@ namespace PathTracer
     {
         return mLights;
     }
+
+    Scene::LightSelection Scene::SampleLight(RNG& rng) const
+    {
+        if (mLights.empty())
+        {
+            return {nullptr, 0.0f};
+        }
+
+        SizeType index = mLightSelection(rng);
+        return {&mLights[Math::ToUnderlying(index)], mLightSelection.Probability(index)};
+    }
+
+    f32 Scene::LightProbability(const Light& light) const
+    {
+        return mLightSelection.Probability(Math::Cast<SizeType>(&light - mLights.data()));
+    }
 }
@@ -3,6 +3,17 @@
 
 #include "Implementation/Geometry/Shapes.hpp"
 #include "Implementation/Geometry/Intersections.hpp"
+#include "Implementation/Geometry/TriangleIntersections.hpp"
+#include "Implementation/Geometry/BoxIntersections.hpp"
+#include "Implementation/Geometry/RayPacket.hpp"
+#include "Implementation/Geometry/AnyIntersections.hpp"
+#include "Implementation/Geometry/Bounds.hpp"
+#include "Implementation/Geometry/Frustum.hpp"
+#include "Implementation/Geometry/BVH.hpp"
+#include "Implementation/Geometry/TriangleMesh.hpp"
+#include "Implementation/Geometry/SphereSet.hpp"
+#include "Implementation/Geometry/Instance.hpp"
+#include "Implementation/Geometry/SpatialHash.hpp"
 
 #include "Implementation/Geometry/2D/Shapes.hpp"
 #include "Implementation/Geometry/2D/Contains.hpp"
@@ -105,16 +105,18 @@ namespace Math
             }
         }
 
+        // Note(3011): Fisher-Yates, element i is swapped with one drawn from
+        // [0, i], so every permutation is equally likely.
         template <Concept::RandomNumberGenerator RNG, template <typename> typename Dist>
             requires Concept::Distribution<Dist<SizeType>, RNG>
         constexpr
         void Shuffle(RNG& rng) noexcept
         {
-            Dist<SizeType> dist(0, Size - 1);
-            for (SizeType i = 0; i < Size; ++i)
+            for (SizeType i = Size; i > 1; --i)
             {
+                Dist<SizeType> dist(0, i - 1);
                 SizeType j = dist(rng);
-                std::swap((*this)[i], (*this)[j]);
+                std::swap((*this)[i - 1], (*this)[j]);
             }
         }
 
@@ -182,6 +182,14 @@ namespace Math
             bool operator==(ThisType a, ThisType b) noexcept { return MATH_NO_WARN(-Wfloat-equal, a.Value == b.Value); }
             [[nodiscard]] friend constexpr
             auto operator<=>(ThisType a, ThisType b) noexcept { return a.Value <=> b.Value; }
+
+            // Note(3011): Rewriting these through operator<=> goes via
+            // std::partial_ordering, which compilers turn into compares and
+            // branches. Spelled out, a < b ? a : b becomes a single minss.
+            [[nodiscard]] friend constexpr bool operator< (ThisType a, ThisType b) noexcept { return a.Value <  b.Value; }
+            [[nodiscard]] friend constexpr bool operator> (ThisType a, ThisType b) noexcept { return a.Value >  b.Value; }
+            [[nodiscard]] friend constexpr bool operator<=(ThisType a, ThisType b) noexcept { return a.Value <= b.Value; }
+            [[nodiscard]] friend constexpr bool operator>=(ThisType a, ThisType b) noexcept { return a.Value >= b.Value; }
         };
     }
 
@@ -132,6 +132,23 @@ namespace Math
         return ((Cast<T>(6) * val - Cast<T>(15)) * val + Cast<T>(10)) * Cubed(val);
     }
 
+    // Note(3011): Derivatives with respect to val, 0 outside of [begin, end].
+    template <Concept::FloatingPointType T>
+    [[nodiscard]] constexpr
+    T SmoothstepDerivative(T val, T begin, T end) noexcept
+    {
+        val = Clamp(InvLerp(val, begin, end));
+        return Cast<T>(6) * val * (Cast<T>(1) - val) / (end - begin);
+    }
+
+    template <Concept::FloatingPointType T>
+    [[nodiscard]] constexpr
+    T SmootherstepDerivative(T val, T begin, T end) noexcept
+    {
+        val = Clamp(InvLerp(val, begin, end));
+        return Cast<T>(30) * Squared(val) * Squared(Cast<T>(1) - val) / (end - begin);
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // Min, Max, Mid
     //////////////////////////////////////////////////////////////////////////
@@ -34,6 +34,22 @@ namespace Math
     {
         return std::countr_zero(val);
     }
+
+    template <Concept::UnsignedIntegralType Int>
+    [[nodiscard]] constexpr
+    Int ReverseBits(Int val) noexcept
+    {
+        using Raw = UnderlyingType<Int>;
+
+        Raw result = ToUnderlying(val);
+        Raw mask = ~Raw(0);
+        for (unsigned shift = sizeof(Raw) * 4; shift > 0; shift >>= 1)
+        {
+            mask ^= Raw(mask << shift);
+            result = Raw(((result >> shift) & mask) | ((result << shift) & ~mask));
+        }
+        return Int(result);
+    }
 }
 
 #endif //MATHLIB_IMPLEMENTATION_FUNCTIONS_INT_UTILS_HPP
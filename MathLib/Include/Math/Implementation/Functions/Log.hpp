@@ -13,6 +13,13 @@ namespace Math
     {
         return std::log(ToUnderlying(val));
     }
+
+    template <Concept::FloatingPointType T>
+    [[nodiscard]] constexpr
+    T LogGamma(T val) noexcept
+    {
+        return std::lgamma(ToUnderlying(val));
+    }
 }
 
 #endif //MATHLIB_IMPLEMENTATION_FUNCTIONS_LOG_HPP
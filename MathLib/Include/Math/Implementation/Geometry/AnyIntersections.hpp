@@ -0,0 +1,192 @@
+#ifndef MATHLIB_IMPLEMENTATION_GEOMETRY_ANY_INTERSECTIONS_HPP
+#define MATHLIB_IMPLEMENTATION_GEOMETRY_ANY_INTERSECTIONS_HPP
+
+// Note(3011):
+// Whether a ray hits a shape within the interval, for shadow rays and other
+// occlusion tests that do not care where. Every AnyIntersection answers
+// exactly like NearestIntersection(...).IsValid(), it only stops as soon as
+// the answer is known and never picks the nearer of two distances.
+
+#include "BoxIntersections.hpp"
+#include "Intersections.hpp"
+#include "RayPacket.hpp"
+
+#include <span>
+
+namespace Math::Geometry
+{
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    bool AnyIntersection(const Ray<T>& ray, const Interval<T>& interval, const Plane<T>& plane) noexcept
+    {
+        T cosIncidence = Dot(ray.Direction, plane.Normal);
+        T offset = Dot(plane.Normal, plane.Origin - ray.Origin);
+        if (Equal(cosIncidence, Cast<T>(0), Constant::GeometryEpsilon<T>))
+        {
+            return Equal(offset, Cast<T>(0), Constant::GeometryEpsilon<T>);
+        }
+
+        T distance = offset / cosIncidence;
+        return interval.Min <= distance && distance <= interval.Max;
+    }
+
+    // Note(3011): The distance is checked against the interval before the
+    // barycentric coordinates, which most shadow rays never need.
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    bool AnyIntersection(const Ray<T>& ray, const Interval<T>& interval, const Triangle<T>& triangle) noexcept
+    {
+        using VectorType = Vector3T<T>;
+
+        VectorType u = triangle.B - triangle.A;
+        VectorType v = triangle.C - triangle.A;
+        VectorType normal = Cross(u, v);
+        if (Equal(normal, VectorType(Cast<T>(0))))
+        {
+            return false;
+        }
+
+        T a = -Dot(normal, ray.Origin - triangle.A);
+        T b = Dot(normal, ray.Direction);
+        if (Equal(b, Cast<T>(0), Constant::GeometryEpsilon<T>))
+        {
+            return Equal(a, Cast<T>(0), Constant::GeometryEpsilon<T>);
+        }
+
+        T distance = a / b;
+        if (distance < Cast<T>(0) || !(interval.Min <= distance && distance <= interval.Max))
+        {
+            return false;
+        }
+
+        VectorType w = ray.Project(distance) - triangle.A;
+        T det = Squared(Dot(u, v)) - u.LenSqr() * v.LenSqr();
+        T s = (Dot(u, v) * Dot(w, v) - v.LenSqr() * Dot(u, w)) / det;
+        T t = (Dot(u, v) * Dot(u, w) - u.LenSqr() * Dot(w, v)) / det;
+        return s > Cast<T>(0) && t > Cast<T>(0) && (s + t) <= Cast<T>(1);
+    }
+
+    // Note(3011): A ray starting outside the sphere, c > 0, and moving away
+    // from it, b < 0, has both roots before 0, so for a positive interval the
+    // square root is never needed.
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    bool AnyIntersection(const Ray<T>& ray, const Interval<T>& interval, const Sphere<T>& sphere) noexcept
+    {
+        Vector3T<T> f = ray.Origin - sphere.Center;
+        T radius2 = Squared(sphere.Radius);
+        T b = -(f.x * ray.Direction.x + f.y * ray.Direction.y + f.z * ray.Direction.z);
+        T c = (f.x * f.x + f.y * f.y + f.z * f.z) - radius2;
+        if (c > Cast<T>(0) && b < Cast<T>(0) && interval.Min > Cast<T>(0))
+        {
+            return false;
+        }
+
+        T t0;
+        T t1;
+        if (!Implementation::SphereRoots<false>(f.x, f.y, f.z, ray.Direction.x, ray.Direction.y, ray.Direction.z, radius2, t0, t1))
+        {
+            return false;
+        }
+        return (interval.Min <= t0 && t0 <= interval.Max) || (interval.Min <= t1 && t1 <= interval.Max);
+    }
+
+    // Note(3011): The box is solid, the ray has to enter or leave it within
+    // the interval, like for NearestIntersection.
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    bool AnyIntersection(const Ray<T>& ray, const Interval<T>& interval, const Box<T>& box) noexcept
+    {
+        BoxIntersection<T> range = SlabIntersection(RayWithInverse<T>(ray), Interval<T>(-T::Infinity(), T::Infinity()), box);
+        return range && ((interval.Min <= range.Entry && range.Entry <= interval.Max) || (interval.Min <= range.Exit && range.Exit <= interval.Max));
+    }
+
+    // Note(3011): Stops at the first shape that is hit.
+    template <Concept::StrongFloatType T, typename Shape>
+    [[nodiscard]] constexpr
+    bool AnyIntersection(const Ray<T>& ray, const Interval<T>& interval, std::span<const Shape> shapes) noexcept
+    {
+        for (const Shape& shape : shapes)
+        {
+            if (AnyIntersection(ray, interval, shape))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Note(3011): For planes and triangles, the packet versions of
+    // NearestIntersection already have nothing to pick, their hits are the
+    // valid lanes.
+    template <Concept::StrongFloatType T, SizeType N>
+    [[nodiscard]] constexpr
+    Array<bool, N> AnyIntersection(const RayPacket<T, N>& packet, const Plane<T>& plane) noexcept
+    {
+        Array<T, N> distances = NearestIntersection(packet, plane);
+        Array<bool, N> hits;
+        for (SizeType lane = 0; lane < N; ++lane)
+        {
+            hits[lane] = distances[lane] == distances[lane];
+        }
+        return hits;
+    }
+
+    template <Concept::StrongFloatType T, SizeType N>
+    [[nodiscard]] constexpr
+    Array<bool, N> AnyIntersection(const RayPacket<T, N>& packet, const Triangle<T>& triangle) noexcept
+    {
+        Array<T, N> distances = NearestIntersection(packet, triangle);
+        Array<bool, N> hits;
+        for (SizeType lane = 0; lane < N; ++lane)
+        {
+            hits[lane] = distances[lane] == distances[lane];
+        }
+        return hits;
+    }
+
+    template <Concept::StrongFloatType T, SizeType N>
+    [[nodiscard]] constexpr
+    Array<bool, N> AnyIntersection(const RayPacket<T, N>& packet, const Sphere<T>& sphere) noexcept
+    {
+        T radius2 = Squared(sphere.Radius);
+        Array<bool, N> hits;
+        for (SizeType lane = 0; lane < N; ++lane)
+        {
+            T t0;
+            T t1;
+            bool real = Implementation::SphereRoots<false>(
+                packet.OriginX[lane] - sphere.Center.x, packet.OriginY[lane] - sphere.Center.y, packet.OriginZ[lane] - sphere.Center.z,
+                packet.DirectionX[lane], packet.DirectionY[lane], packet.DirectionZ[lane], radius2, t0, t1);
+
+            T min = packet.IntervalMin[lane];
+            T max = packet.IntervalMax[lane];
+            bool inside = (min <= t0 && t0 <= max) || (min <= t1 && t1 <= max);
+            hits[lane] = packet.Active[lane] && real && inside;
+        }
+        return hits;
+    }
+
+    template <Concept::StrongFloatType T, SizeType N>
+    [[nodiscard]] constexpr
+    Array<bool, N> AnyIntersection(const RayPacket<T, N>& packet, const Box<T>& box) noexcept
+    {
+        Array<bool, N> hits;
+        for (SizeType lane = 0; lane < N; ++lane)
+        {
+            T entry = -T::Infinity();
+            T exit = T::Infinity();
+            Implementation::ClipSlab(box.Min.x, box.Max.x, packet.OriginX[lane], Cast<T>(1) / packet.DirectionX[lane], entry, exit);
+            Implementation::ClipSlab(box.Min.y, box.Max.y, packet.OriginY[lane], Cast<T>(1) / packet.DirectionY[lane], entry, exit);
+            Implementation::ClipSlab(box.Min.z, box.Max.z, packet.OriginZ[lane], Cast<T>(1) / packet.DirectionZ[lane], entry, exit);
+
+            T min = packet.IntervalMin[lane];
+            T max = packet.IntervalMax[lane];
+            bool inside = (min <= entry && entry <= max) || (min <= exit && exit <= max);
+            hits[lane] = packet.Active[lane] && entry <= exit && inside;
+        }
+        return hits;
+    }
+}
+
+#endif //MATHLIB_IMPLEMENTATION_GEOMETRY_ANY_INTERSECTIONS_HPP
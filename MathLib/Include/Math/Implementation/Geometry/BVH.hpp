@@ -0,0 +1,458 @@
+#ifndef MATHLIB_IMPLEMENTATION_GEOMETRY_BVH_HPP
+#define MATHLIB_IMPLEMENTATION_GEOMETRY_BVH_HPP
+
+// Note(3011):
+// Bounding volume hierarchy over axis aligned boxes. It only knows the
+// bounds of the primitives, the primitives themselves are intersected by a
+// callable, so it works for the shapes of this module as well as for any
+// user type. The tree is built top down with the surface area heuristic,
+// evaluated on a fixed number of bins per axis instead of on every possible
+// split, which keeps the build O(n log n). Primitives without finite bounds,
+// like planes, are kept out of the tree and tested on every ray.
+
+#include "../Base/Array.hpp"
+#include "AnyIntersections.hpp"
+#include "BoxIntersections.hpp"
+#include "Bounds.hpp"
+#include "Intersections.hpp"
+
+#include <algorithm>
+#include <span>
+#include <vector>
+
+namespace Math::Geometry
+{
+    template <Concept::StrongFloatType T>
+    class BVH final
+    {
+    public:
+        using ScalarType = T;
+        using BoxType = Box<T>;
+
+        // Note(3011): The first child of an inner node directly follows it,
+        // Offset is the index of the second one. For a leaf, Count > 0 and
+        // Offset is the first of its entries in Indices().
+        struct Node
+        {
+            BoxType Bounds;
+            u32 Offset;
+            u32 Count;
+        };
+
+        struct Hit
+        {
+        public:
+            [[nodiscard]] constexpr
+            bool IsValid() const noexcept
+            {
+                return Distance == Distance;
+            }
+
+            [[nodiscard]] constexpr explicit
+            operator bool () const noexcept
+            {
+                return IsValid();
+            }
+
+            T Distance;
+            SizeType Index;
+        };
+
+        static constexpr SizeType MaxDepth = 64;
+        static constexpr SizeType BinCount = 16;
+
+        [[nodiscard]]
+        BVH() noexcept = default;
+
+        // Note(3011): Ranges of up to leafSize primitives become leaves,
+        // larger ones are always split.
+        [[nodiscard]] explicit
+        BVH(std::span<const BoxType> bounds, SizeType leafSize = 4)
+        {
+            Build(bounds, leafSize);
+        }
+
+        template <typename Shape>
+            requires requires (const Shape& shape) { { BoundingBox(shape) } -> Concept::IsSame<BoxType>; }
+        [[nodiscard]] explicit
+        BVH(std::span<const Shape> shapes, SizeType leafSize = 4)
+        {
+            Build(BoundingBoxes(shapes), leafSize);
+        }
+
+        [[nodiscard]]
+        std::span<const Node> Nodes() const noexcept
+        {
+            return mNodes;
+        }
+
+        [[nodiscard]]
+        std::span<const u32> Indices() const noexcept
+        {
+            return mIndices;
+        }
+
+        [[nodiscard]]
+        std::span<const u32> Unbounded() const noexcept
+        {
+            return mUnbounded;
+        }
+
+        // Note(3011): intersect(index, ray, interval) returns the
+        // Intersection<T> of the primitive within the interval. The interval
+        // is shrunk to the nearest hit found so far before every call, so a
+        // valid hit is always the new nearest one.
+        template <typename Intersector>
+        [[nodiscard]]
+        Hit NearestIntersection(const Ray<T>& ray, const Interval<T>& interval, Intersector&& intersect) const
+        {
+            Hit nearest = { T::NaN(), SizeType(0) };
+            Interval<T> current = interval;
+            auto test = [&](u32 index)
+            {
+                Intersection<T> hit = intersect(Cast<SizeType>(index), ray, current);
+                if (hit.IsValid())
+                {
+                    nearest = { hit.Distance, Cast<SizeType>(index) };
+                    current.Max = hit.Distance;
+                }
+            };
+
+            for (u32 index : mUnbounded)
+            {
+                test(index);
+            }
+
+            Traverse<false>(ray, current, [&](const Node& leaf)
+            {
+                for (u32 i = leaf.Offset; i < leaf.Offset + leaf.Count; ++i)
+                {
+                    test(mIndices[ToUnderlying(i)]);
+                }
+                return false;
+            });
+
+            return nearest;
+        }
+
+        // Note(3011): occluded(index, ray, interval) returns whether the
+        // primitive is hit within the interval. Stops at the first hit,
+        // without looking for the nearest one.
+        template <typename Predicate>
+        [[nodiscard]]
+        bool HasIntersection(const Ray<T>& ray, const Interval<T>& interval, Predicate&& occluded) const
+        {
+            for (u32 index : mUnbounded)
+            {
+                if (occluded(Cast<SizeType>(index), ray, interval))
+                {
+                    return true;
+                }
+            }
+
+            return Traverse<true>(ray, interval, [&](const Node& leaf)
+            {
+                for (u32 i = leaf.Offset; i < leaf.Offset + leaf.Count; ++i)
+                {
+                    if (occluded(Cast<SizeType>(mIndices[ToUnderlying(i)]), ray, interval))
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            });
+        }
+    private:
+        struct Entry
+        {
+            u32 Node;
+            T Distance;
+        };
+
+        // Note(3011): Visits the leaves the ray enters, near child first.
+        // Subtrees entered beyond interval.Max are skipped, which prunes more
+        // as the nearest hit shrinks the interval. Stops as soon as visit
+        // returns true.
+        template <bool AnyHit, typename Visitor>
+        bool Traverse(const Ray<T>& ray, const Interval<T>& interval, Visitor&& visit) const
+        {
+            if (mNodes.empty())
+            {
+                return false;
+            }
+
+            RayWithInverse<T> inverseRay(ray);
+            auto entryDistance = [&](u32 index)
+            {
+                BoxIntersection<T> range = SlabIntersection(inverseRay, interval, mNodes[ToUnderlying(index)].Bounds);
+                return range ? range.Entry : T::NaN();
+            };
+
+            T rootDistance = entryDistance(u32(0));
+            if (rootDistance != rootDistance)
+            {
+                return false;
+            }
+
+            Array<Entry, MaxDepth> stack;
+            SizeType size = 0;
+            stack[size++] = { u32(0), rootDistance };
+            while (size > 0)
+            {
+                Entry entry = stack[--size];
+                if (entry.Distance > interval.Max)
+                {
+                    continue;
+                }
+
+                const Node& node = mNodes[ToUnderlying(entry.Node)];
+                if (node.Count > u32(0))
+                {
+                    if (visit(node))
+                    {
+                        return true;
+                    }
+                    continue;
+                }
+
+                u32 first = entry.Node + u32(1);
+                u32 second = node.Offset;
+                T firstDistance = entryDistance(first);
+                T secondDistance = entryDistance(second);
+                bool hitFirst = firstDistance == firstDistance;
+                bool hitSecond = secondDistance == secondDistance;
+                if (hitFirst && hitSecond)
+                {
+                    // Note(3011): The near child goes on top of the stack.
+                    if (!AnyHit && firstDistance > secondDistance)
+                    {
+                        stack[size++] = { first, firstDistance };
+                        stack[size++] = { second, secondDistance };
+                    }
+                    else
+                    {
+                        stack[size++] = { second, secondDistance };
+                        stack[size++] = { first, firstDistance };
+                    }
+                }
+                else if (hitFirst)
+                {
+                    stack[size++] = { first, firstDistance };
+                }
+                else if (hitSecond)
+                {
+                    stack[size++] = { second, secondDistance };
+                }
+            }
+
+            return false;
+        }
+
+        void Build(std::span<const BoxType> bounds, SizeType leafSize)
+        {
+            mLeafSize = Max(leafSize, SizeType(1));
+            mCentroids.resize(bounds.size());
+            for (SizeType i = 0; i < SizeType(bounds.size()); ++i)
+            {
+                const BoxType& box = bounds[ToUnderlying(i)];
+                Vector3T<T> extent = box.Max - box.Min;
+                if (extent.x < T::Infinity() && extent.y < T::Infinity() && extent.z < T::Infinity())
+                {
+                    mIndices.push_back(Cast<u32>(i));
+                    mCentroids[ToUnderlying(i)] = box.Min + extent * Cast<T>(0.5);
+                }
+                else
+                {
+                    mUnbounded.push_back(Cast<u32>(i));
+                }
+            }
+
+            if (!mIndices.empty())
+            {
+                mNodes.reserve(2 * mIndices.size());
+                BuildNode(bounds, SizeType(0), SizeType(mIndices.size()), SizeType(0));
+            }
+            mCentroids = {};
+        }
+
+        void BuildNode(std::span<const BoxType> bounds, SizeType begin, SizeType end, SizeType depth)
+        {
+            Implementation::GrowingBox<T> nodeBounds;
+            Implementation::GrowingBox<T> centroidBounds;
+            for (SizeType i = begin; i < end; ++i)
+            {
+                u32 index = mIndices[ToUnderlying(i)];
+                nodeBounds.Grow(bounds[ToUnderlying(index)]);
+                centroidBounds.Grow(mCentroids[ToUnderlying(index)]);
+            }
+
+            SizeType nodeIndex = SizeType(mNodes.size());
+            mNodes.push_back({ BoxType(nodeBounds.Min, nodeBounds.Max), Cast<u32>(begin), Cast<u32>(end - begin) });
+
+            SizeType count = end - begin;
+            if (count <= mLeafSize || depth + SizeType(1) >= MaxDepth)
+            {
+                return;
+            }
+
+            // Note(3011): When the centroids coincide or no split pays off,
+            // halving the range still keeps the leaves small.
+            SizeType middle = Split(bounds, begin, end, nodeBounds, centroidBounds);
+            if (middle == begin)
+            {
+                middle = begin + count / SizeType(2);
+            }
+
+            BuildNode(bounds, begin, middle, depth + SizeType(1));
+            mNodes[ToUnderlying(nodeIndex)].Offset = Cast<u32>(SizeType(mNodes.size()));
+            mNodes[ToUnderlying(nodeIndex)].Count = u32(0);
+            BuildNode(bounds, middle, end, depth + SizeType(1));
+        }
+
+        // Note(3011): Returns the end of the first half of the partitioned
+        // range, or begin if no split is cheaper than a leaf. Costs are
+        // in units of primitive intersections, a traversal step counts as one.
+        SizeType Split(std::span<const BoxType> bounds, SizeType begin, SizeType end,
+                       const Implementation::GrowingBox<T>& nodeBounds, const Implementation::GrowingBox<T>& centroidBounds)
+        {
+            struct Bin
+            {
+                Implementation::GrowingBox<T> Bounds;
+                SizeType Count = 0;
+            };
+
+            SizeType count = end - begin;
+            T bestCost = Cast<T>(count) * nodeBounds.HalfArea();
+            SizeType bestAxis = 3;
+            SizeType bestBin = 0;
+
+            // Note(3011): All three axes are binned in the same pass over the
+            // primitives, which are scattered in memory. Along an axis where
+            // the centroids coincide, everything lands in the first bin and
+            // no split is found.
+            Vector3T<T> low(centroidBounds.Min);
+            Vector3T<T> scale;
+            for (SizeType axis = 0; axis < 3; ++axis)
+            {
+                T extent = centroidBounds.Max[axis] - centroidBounds.Min[axis];
+                scale[axis] = extent > Cast<T>(0) ? Cast<T>(BinCount) / extent : Cast<T>(0);
+            }
+
+            Array<Array<Bin, BinCount>, 3> bins;
+            for (SizeType i = begin; i < end; ++i)
+            {
+                u32 index = mIndices[ToUnderlying(i)];
+                const Point<T>& centroid = mCentroids[ToUnderlying(index)];
+                const BoxType& box = bounds[ToUnderlying(index)];
+                for (SizeType axis = 0; axis < 3; ++axis)
+                {
+                    Bin& bin = bins[axis][BinIndex(centroid[axis], low[axis], scale[axis])];
+                    bin.Bounds.Grow(box);
+                    ++bin.Count;
+                }
+            }
+
+            for (SizeType axis = 0; axis < 3; ++axis)
+            {
+                // Note(3011): Right to left, the cost of everything right of a
+                // split, then left to right adding the rest.
+                Array<T, BinCount> rightCosts;
+                Implementation::GrowingBox<T> right;
+                SizeType rightCount = 0;
+                for (SizeType bin = BinCount - SizeType(1); bin > SizeType(0); --bin)
+                {
+                    const Bin& current = bins[axis][bin];
+                    if (current.Count > SizeType(0))
+                    {
+                        right.Grow(current.Bounds.Min);
+                        right.Grow(current.Bounds.Max);
+                    }
+                    rightCount += current.Count;
+                    rightCosts[bin] = rightCount > SizeType(0) ? Cast<T>(rightCount) * right.HalfArea() : Cast<T>(0);
+                }
+
+                Implementation::GrowingBox<T> left;
+                SizeType leftCount = 0;
+                for (SizeType bin = 0; bin + SizeType(1) < BinCount; ++bin)
+                {
+                    const Bin& current = bins[axis][bin];
+                    if (current.Count > SizeType(0))
+                    {
+                        left.Grow(current.Bounds.Min);
+                        left.Grow(current.Bounds.Max);
+                    }
+                    leftCount += current.Count;
+                    if (leftCount == SizeType(0) || leftCount == count)
+                    {
+                        continue;
+                    }
+
+                    T cost = nodeBounds.HalfArea() + Cast<T>(leftCount) * left.HalfArea() + rightCosts[bin + SizeType(1)];
+                    if (cost < bestCost)
+                    {
+                        bestCost = cost;
+                        bestAxis = axis;
+                        bestBin = bin;
+                    }
+                }
+            }
+
+            if (bestAxis == SizeType(3))
+            {
+                return begin;
+            }
+
+            auto first = mIndices.begin() + ToUnderlying(begin);
+            auto last = mIndices.begin() + ToUnderlying(end);
+            auto middle = std::partition(first, last, [&](u32 index)
+            {
+                return BinIndex(mCentroids[ToUnderlying(index)][bestAxis], low[bestAxis], scale[bestAxis]) <= bestBin;
+            });
+            return begin + SizeType(middle - first);
+        }
+
+        [[nodiscard]] static
+        SizeType BinIndex(T centroid, T low, T scale) noexcept
+        {
+            return Min(Cast<SizeType>(Trunc<i64>((centroid - low) * scale)), BinCount - SizeType(1));
+        }
+
+        std::vector<Node> mNodes;
+        std::vector<u32> mIndices;
+        std::vector<u32> mUnbounded;
+        std::vector<Point<T>> mCentroids;
+        SizeType mLeafSize = 4;
+    };
+
+    // Note(3011): Intersects the shapes the BVH was built over, the index of
+    // the hit is the one of the shape in the span.
+    template <Concept::StrongFloatType T, typename Shape>
+    [[nodiscard]]
+    typename BVH<T>::Hit NearestIntersection(const Ray<T>& ray, const Interval<T>& interval, const BVH<T>& bvh, std::span<const Shape> shapes)
+    {
+        return bvh.NearestIntersection(ray, interval, [shapes](SizeType index, const Ray<T>& r, const Interval<T>& i)
+        {
+            return NearestIntersection(r, i, shapes[ToUnderlying(index)]);
+        });
+    }
+
+    template <Concept::StrongFloatType T, typename Shape>
+    [[nodiscard]]
+    bool HasIntersection(const Ray<T>& ray, const Interval<T>& interval, const BVH<T>& bvh, std::span<const Shape> shapes)
+    {
+        return bvh.HasIntersection(ray, interval, [shapes](SizeType index, const Ray<T>& r, const Interval<T>& i)
+        {
+            const Shape& shape = shapes[ToUnderlying(index)];
+            if constexpr (requires { { AnyIntersection(r, i, shape) } -> Concept::IsSame<bool>; })
+            {
+                return AnyIntersection(r, i, shape);
+            }
+            else
+            {
+                return NearestIntersection(r, i, shape).IsValid();
+            }
+        });
+    }
+}
+
+#endif //MATHLIB_IMPLEMENTATION_GEOMETRY_BVH_HPP
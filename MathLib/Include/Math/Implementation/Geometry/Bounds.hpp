@@ -0,0 +1,263 @@
+#ifndef MATHLIB_IMPLEMENTATION_GEOMETRY_BOUNDS_HPP
+#define MATHLIB_IMPLEMENTATION_GEOMETRY_BOUNDS_HPP
+
+#include "Shapes.hpp"
+
+#include <span>
+#include <vector>
+
+namespace Math::Geometry::Implementation
+{
+    // Note(3011): Box::Box sorts its corners, which an empty box (inverted,
+    // from +inf to -inf) does not survive. Bounds are grown in these instead.
+    template <Concept::StrongFloatType T>
+    struct GrowingBox
+    {
+    public:
+        constexpr
+        void Grow(const Point<T>& point) noexcept
+        {
+            Min = Point<T>(Math::Min(Min.x, point.x), Math::Min(Min.y, point.y), Math::Min(Min.z, point.z));
+            Max = Point<T>(Math::Max(Max.x, point.x), Math::Max(Max.y, point.y), Math::Max(Max.z, point.z));
+        }
+
+        constexpr
+        void Grow(const Box<T>& box) noexcept
+        {
+            Grow(box.Min);
+            Grow(box.Max);
+        }
+
+        [[nodiscard]] constexpr
+        T HalfArea() const noexcept
+        {
+            Vector3T<T> extent = Max - Min;
+            return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+        }
+
+        Point<T> Min = Point<T>(T::Infinity());
+        Point<T> Max = Point<T>(-T::Infinity());
+    };
+}
+
+namespace Math::Geometry
+{
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    Box<T> BoundingBox(const Point<T>& point) noexcept
+    {
+        return Box<T>(point, point);
+    }
+
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    Box<T> BoundingBox(const Sphere<T>& sphere) noexcept
+    {
+        Vector3T<T> radius(Abs(sphere.Radius));
+        return Box<T>(sphere.Center - radius, sphere.Center + radius);
+    }
+
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    Box<T> BoundingBox(const Triangle<T>& triangle) noexcept
+    {
+        Point<T> min(
+            Min(triangle.A.x, triangle.B.x, triangle.C.x),
+            Min(triangle.A.y, triangle.B.y, triangle.C.y),
+            Min(triangle.A.z, triangle.B.z, triangle.C.z)
+        );
+
+        Point<T> max(
+            Max(triangle.A.x, triangle.B.x, triangle.C.x),
+            Max(triangle.A.y, triangle.B.y, triangle.C.y),
+            Max(triangle.A.z, triangle.B.z, triangle.C.z)
+        );
+
+        return Box<T>(min, max);
+    }
+
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    Box<T> BoundingBox(const Box<T>& box) noexcept
+    {
+        return Box<T>(box.Min, box.Max);
+    }
+
+    // Note(3011): A plane is unbounded, its box is the whole space.
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    Box<T> BoundingBox([[maybe_unused]] const Plane<T>& plane) noexcept
+    {
+        return Box<T>(Point<T>(-T::Infinity()), Point<T>(T::Infinity()));
+    }
+
+    // Note(3011): Arvo, "Transforming Axis-Aligned Bounding Boxes". Each
+    // coordinate of the new box is the translation plus, for every column,
+    // the smaller or larger of the products with the old minimum and maximum.
+    // Exact for the box, without transforming its eight corners. The
+    // transform must be affine, the default bottom row.
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    Box<T> BoundingBox(const Transform3T<T>& transform, const Box<T>& box) noexcept
+    {
+        Array<T, 3> min;
+        Array<T, 3> max;
+        for (SizeType i = 0; i < 3; ++i)
+        {
+            min[i] = transform[i][3];
+            max[i] = transform[i][3];
+            for (SizeType j = 0; j < 3; ++j)
+            {
+                T a = transform[i][j] * box.Min[j];
+                T b = transform[i][j] * box.Max[j];
+                min[i] += Min(a, b);
+                max[i] += Max(a, b);
+            }
+        }
+        return Box<T>(Point<T>(min[0], min[1], min[2]), Point<T>(max[0], max[1], max[2]));
+    }
+
+    // Note(3011): The transformed box of the sphere, under rotations it is
+    // larger than the box of the transformed sphere.
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    Box<T> BoundingBox(const Transform3T<T>& transform, const Sphere<T>& sphere) noexcept
+    {
+        return BoundingBox(transform, BoundingBox(sphere));
+    }
+
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    Box<T> BoundingBox(const Transform3T<T>& transform, const Triangle<T>& triangle) noexcept
+    {
+        return BoundingBox(Triangle<T>(transform * triangle.A, transform * triangle.B, transform * triangle.C));
+    }
+
+    // Note(3011): Bounds of all shapes together, a box at the origin when
+    // there are none.
+    template <typename Shape>
+        requires requires (const Shape& shape) { BoundingBox(shape); }
+    [[nodiscard]] constexpr
+    auto BoundingBox(std::span<const Shape> shapes) noexcept
+    {
+        using T = typename decltype(BoundingBox(shapes.front()))::ScalarType;
+
+        if (shapes.empty())
+        {
+            return Box<T>(Point<T>(Cast<T>(0)), Point<T>(Cast<T>(0)));
+        }
+
+        Implementation::GrowingBox<T> bounds;
+        for (const Shape& shape : shapes)
+        {
+            bounds.Grow(BoundingBox(shape));
+        }
+        return Box<T>(bounds.Min, bounds.Max);
+    }
+
+    // Note(3011): One box per shape, in order, as a BVH takes them.
+    template <typename Shape>
+        requires requires (const Shape& shape) { BoundingBox(shape); }
+    [[nodiscard]]
+    auto BoundingBoxes(std::span<const Shape> shapes)
+    {
+        std::vector<decltype(BoundingBox(shapes.front()))> boxes;
+        boxes.reserve(shapes.size());
+        for (const Shape& shape : shapes)
+        {
+            boxes.push_back(BoundingBox(shape));
+        }
+        return boxes;
+    }
+
+    // Note(3011): The matrix is read once, the loop runs on plain components
+    // so it can be vectorized across boxes.
+    template <Concept::StrongFloatType T>
+    [[nodiscard]]
+    std::vector<Box<T>> BoundingBoxes(const Transform3T<T>& transform, std::span<const Box<T>> boxes)
+    {
+        Array<T, 12> m;
+        for (SizeType i = 0; i < 3; ++i)
+        {
+            for (SizeType j = 0; j < 4; ++j)
+            {
+                m[i * SizeType(4) + j] = transform[i][j];
+            }
+        }
+
+        std::vector<Box<T>> result;
+        result.reserve(boxes.size());
+        for (const Box<T>& box : boxes)
+        {
+            Array<T, 6> bounds;
+            for (SizeType i = 0; i < 3; ++i)
+            {
+                T min = m[i * SizeType(4) + SizeType(3)];
+                T max = min;
+                T ax = m[i * SizeType(4)] * box.Min.x;
+                T bx = m[i * SizeType(4)] * box.Max.x;
+                T ay = m[i * SizeType(4) + SizeType(1)] * box.Min.y;
+                T by = m[i * SizeType(4) + SizeType(1)] * box.Max.y;
+                T az = m[i * SizeType(4) + SizeType(2)] * box.Min.z;
+                T bz = m[i * SizeType(4) + SizeType(2)] * box.Max.z;
+                min += Min(ax, bx);
+                max += Max(ax, bx);
+                min += Min(ay, by);
+                max += Max(ay, by);
+                min += Min(az, bz);
+                max += Max(az, bz);
+                bounds[i] = min;
+                bounds[i + SizeType(3)] = max;
+            }
+            result.push_back(Box<T>(Point<T>(bounds[0], bounds[1], bounds[2]), Point<T>(bounds[3], bounds[4], bounds[5])));
+        }
+        return result;
+    }
+
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    Box<T> Union(const Box<T>& a, const Box<T>& b) noexcept
+    {
+        Point<T> min(Min(a.Min.x, b.Min.x), Min(a.Min.y, b.Min.y), Min(a.Min.z, b.Min.z));
+        Point<T> max(Max(a.Max.x, b.Max.x), Max(a.Max.y, b.Max.y), Max(a.Max.z, b.Max.z));
+        return Box<T>(min, max);
+    }
+
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    Box<T> Union(const Box<T>& box, const Point<T>& point) noexcept
+    {
+        return Union(box, BoundingBox(point));
+    }
+
+    // Note(3011): Touching boxes overlap.
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    bool Overlaps(const Box<T>& a, const Box<T>& b) noexcept
+    {
+        return a.Min.x <= b.Max.x && b.Min.x <= a.Max.x &&
+               a.Min.y <= b.Max.y && b.Min.y <= a.Max.y &&
+               a.Min.z <= b.Max.z && b.Min.z <= a.Max.z;
+    }
+
+    // Note(3011): Only meaningful for boxes that overlap. Along an axis where
+    // they are apart, the result is flat, at the larger of the two minimums.
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    Box<T> Intersect(const Box<T>& a, const Box<T>& b) noexcept
+    {
+        Point<T> min(Max(a.Min.x, b.Min.x), Max(a.Min.y, b.Min.y), Max(a.Min.z, b.Min.z));
+        Point<T> max(Min(a.Max.x, b.Max.x), Min(a.Max.y, b.Max.y), Min(a.Max.z, b.Max.z));
+        return Box<T>(min, Point<T>(Max(min.x, max.x), Max(min.y, max.y), Max(min.z, max.z)));
+    }
+
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    T SurfaceArea(const Box<T>& box) noexcept
+    {
+        Vector3T<T> extent = box.Max - box.Min;
+        return Cast<T>(2) * (extent.x * extent.y + extent.y * extent.z + extent.z * extent.x);
+    }
+}
+
+#endif //MATHLIB_IMPLEMENTATION_GEOMETRY_BOUNDS_HPP
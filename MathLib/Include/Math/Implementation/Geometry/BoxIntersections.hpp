@@ -0,0 +1,189 @@
+#ifndef MATHLIB_IMPLEMENTATION_GEOMETRY_BOX_INTERSECTIONS_HPP
+#define MATHLIB_IMPLEMENTATION_GEOMETRY_BOX_INTERSECTIONS_HPP
+
+// Note(3011):
+// Slab tests of rays against axis aligned boxes. The box is cut into three
+// slabs, pairs of planes, and the ray is inside the box where it is inside
+// all of them. The tests multiply by the inverse direction, computed once
+// per ray, and select instead of branching.
+
+#include "../Base/Array.hpp"
+#include "Shapes.hpp"
+
+#include <span>
+
+namespace Math::Geometry
+{
+    template <Concept::StrongFloatType T>
+    struct RayWithInverse : public Ray<T>
+    {
+    public:
+        using ScalarType = T;
+        using VectorType = Vector3T<T>;
+
+        // Note(3011): Zero direction components give infinite inverses, which
+        // the slab tests expect.
+        [[nodiscard]] constexpr explicit
+        RayWithInverse(const Ray<T>& ray) noexcept
+            : Ray<T>(ray), InverseDirection(Cast<T>(1) / ray.Direction.x, Cast<T>(1) / ray.Direction.y, Cast<T>(1) / ray.Direction.z)
+        {}
+
+        VectorType InverseDirection;
+    };
+
+    // Note(3011): The part of the ray inside a box, invalid if there is none.
+    template <Concept::StrongFloatType T>
+    struct BoxIntersection
+    {
+    public:
+        using ScalarType = T;
+
+        [[nodiscard]] constexpr
+        bool IsValid() const noexcept
+        {
+            return Entry <= Exit;
+        }
+
+        [[nodiscard]] constexpr explicit
+        operator bool () const noexcept
+        {
+            return IsValid();
+        }
+
+        ScalarType Entry;
+        ScalarType Exit;
+    };
+
+    // Note(3011): N boxes stored component by component, like the children
+    // of a wide BVH node. Lanes that are not active are never hit.
+    template <Concept::StrongFloatType T, SizeType N>
+    struct BoxPacket
+    {
+    public:
+        using ScalarType = T;
+        using LaneType = Array<T, N>;
+
+        static constexpr SizeType Width = N;
+
+        [[nodiscard]] constexpr
+        BoxPacket() noexcept = default;
+
+        // Note(3011): Lanes beyond the end of boxes stay inactive.
+        [[nodiscard]] constexpr explicit
+        BoxPacket(std::span<const Box<T>> boxes) noexcept
+        {
+            for (SizeType lane = 0; lane < Min(N, SizeType(boxes.size())); ++lane)
+            {
+                Set(lane, boxes[ToUnderlying(lane)]);
+            }
+        }
+
+        constexpr
+        void Set(SizeType lane, const Box<T>& box) noexcept
+        {
+            MinX[lane] = box.Min.x;
+            MinY[lane] = box.Min.y;
+            MinZ[lane] = box.Min.z;
+            MaxX[lane] = box.Max.x;
+            MaxY[lane] = box.Max.y;
+            MaxZ[lane] = box.Max.z;
+            Active[lane] = true;
+        }
+
+        [[nodiscard]] constexpr
+        Box<T> GetBox(SizeType lane) const noexcept
+        {
+            return Box<T>(Point<T>(MinX[lane], MinY[lane], MinZ[lane]), Point<T>(MaxX[lane], MaxY[lane], MaxZ[lane]));
+        }
+
+        LaneType MinX;
+        LaneType MinY;
+        LaneType MinZ;
+        LaneType MaxX;
+        LaneType MaxY;
+        LaneType MaxZ;
+        Array<bool, N> Active;
+    };
+
+    template <Concept::StrongFloatType T>
+    using BoxPacket4 = BoxPacket<T, 4>;
+
+    template <Concept::StrongFloatType T>
+    using BoxPacket8 = BoxPacket<T, 8>;
+}
+
+namespace Math::Geometry::Implementation
+{
+    // Note(3011): Narrows [entry, exit] to the part of the ray between the
+    // two planes of a slab. A ray parallel to the slab has infinite inverse
+    // direction and gets infinite distances, except when it starts right on
+    // one of the planes, where 0 * inf is NaN. It then runs inside the slab
+    // for its whole length, the faces belong to the box. This is the only
+    // NaN these tests expect, rays or boxes with NaN components give
+    // unspecified results.
+    template <Concept::StrongFloatType T>
+    constexpr
+    void ClipSlab(T min, T max, T origin, T inverseDirection, T& entry, T& exit) noexcept
+    {
+        T t0 = (min - origin) * inverseDirection;
+        T t1 = (max - origin) * inverseDirection;
+        bool onPlane = t0 != t0 || t1 != t1;
+        T near = onPlane ? -T::Infinity() : Min(t0, t1);
+        T far = onPlane ? T::Infinity() : Max(t0, t1);
+        entry = Max(entry, near);
+        exit = Min(exit, far);
+    }
+}
+
+namespace Math::Geometry
+{
+    // Note(3011): Entry and exit are clipped to the interval. The entry is
+    // interval.Min for rays starting inside the box.
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    BoxIntersection<T> SlabIntersection(const RayWithInverse<T>& ray, const Interval<T>& interval, const Box<T>& box) noexcept
+    {
+        T entry = interval.Min;
+        T exit = interval.Max;
+        Implementation::ClipSlab(box.Min.x, box.Max.x, ray.Origin.x, ray.InverseDirection.x, entry, exit);
+        Implementation::ClipSlab(box.Min.y, box.Max.y, ray.Origin.y, ray.InverseDirection.y, entry, exit);
+        Implementation::ClipSlab(box.Min.z, box.Max.z, ray.Origin.z, ray.InverseDirection.z, entry, exit);
+        return { entry, exit };
+    }
+
+    // Note(3011): One ray against N boxes, the entry distance for each of
+    // them, NaN for the ones it misses within the interval.
+    template <Concept::StrongFloatType T, SizeType N>
+    [[nodiscard]] constexpr
+    Array<T, N> EntryDistances(const RayWithInverse<T>& ray, const Interval<T>& interval, const BoxPacket<T, N>& boxes) noexcept
+    {
+        Array<T, N> distances;
+        for (SizeType lane = 0; lane < N; ++lane)
+        {
+            T entry = interval.Min;
+            T exit = interval.Max;
+            Implementation::ClipSlab(boxes.MinX[lane], boxes.MaxX[lane], ray.Origin.x, ray.InverseDirection.x, entry, exit);
+            Implementation::ClipSlab(boxes.MinY[lane], boxes.MaxY[lane], ray.Origin.y, ray.InverseDirection.y, entry, exit);
+            Implementation::ClipSlab(boxes.MinZ[lane], boxes.MaxZ[lane], ray.Origin.z, ray.InverseDirection.z, entry, exit);
+            distances[lane] = (boxes.Active[lane] && entry <= exit) ? entry : T::NaN();
+        }
+        return distances;
+    }
+
+    // Note(3011): The box is solid, a ray starting inside hits it where it
+    // leaves, like it would a sphere.
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    Intersection<T> NearestIntersection(const Ray<T>& ray, const Interval<T>& interval, const Box<T>& box) noexcept
+    {
+        BoxIntersection<T> range = SlabIntersection(RayWithInverse<T>(ray), Interval<T>(-T::Infinity(), T::Infinity()), box);
+        if (!range)
+        {
+            return Intersection<T>(T::NaN());
+        }
+
+        return Intersection<T>(interval.Pick(range.Entry, range.Exit));
+    }
+}
+
+#endif //MATHLIB_IMPLEMENTATION_GEOMETRY_BOX_INTERSECTIONS_HPP
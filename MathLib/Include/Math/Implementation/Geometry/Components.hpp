@@ -0,0 +1,44 @@
+#ifndef MATHLIB_IMPLEMENTATION_GEOMETRY_COMPONENTS_HPP
+#define MATHLIB_IMPLEMENTATION_GEOMETRY_COMPONENTS_HPP
+
+#include "Shapes.hpp"
+
+#include <vector>
+
+namespace Math::Geometry::Implementation
+{
+    // Note(3011): Points or vectors stored component by component, for the
+    // shape collections that intersect many of them in one loop.
+    template <Concept::StrongFloatType T>
+    struct Components
+    {
+    public:
+        void Resize(SizeType size)
+        {
+            X.resize(ToUnderlying(size));
+            Y.resize(ToUnderlying(size));
+            Z.resize(ToUnderlying(size));
+        }
+
+        template <typename Vec>
+        void Set(SizeType index, const Vec& value) noexcept
+        {
+            X[ToUnderlying(index)] = value.x;
+            Y[ToUnderlying(index)] = value.y;
+            Z[ToUnderlying(index)] = value.z;
+        }
+
+        template <typename Vec>
+        [[nodiscard]]
+        Vec Get(SizeType index) const noexcept
+        {
+            return Vec(X[ToUnderlying(index)], Y[ToUnderlying(index)], Z[ToUnderlying(index)]);
+        }
+
+        std::vector<T> X;
+        std::vector<T> Y;
+        std::vector<T> Z;
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_GEOMETRY_COMPONENTS_HPP
@@ -0,0 +1,167 @@
+#ifndef MATHLIB_IMPLEMENTATION_GEOMETRY_FRUSTUM_HPP
+#define MATHLIB_IMPLEMENTATION_GEOMETRY_FRUSTUM_HPP
+
+// Note(3011):
+// View frustum as six planes, extracted from a view projection matrix with
+// the method of Gribb and Hartmann. The clip space is the one of
+// PerspectiveProjection and OrthographicProjection, -w <= x, y <= w and
+// 0 <= z <= w. The tests are conservative, a shape is only rejected when it
+// lies fully behind one of the planes, so some shapes near the edges of the
+// frustum pass even though they are outside.
+
+#include "../Base/Array.hpp"
+#include "../../Matrix.hpp"
+#include "Shapes.hpp"
+
+#include <span>
+
+namespace Math::Geometry
+{
+    // Note(3011): The planes are stored component by component, in the
+    // order left, right, bottom, top, near, far. Their normals point into the
+    // frustum and have unit length, so Dot(normal, p) + offset is the signed
+    // distance of p to the plane.
+    template <Concept::StrongFloatType T>
+    struct Frustum
+    {
+    public:
+        using ScalarType = T;
+        using LaneType = Array<T, 6>;
+
+        static constexpr SizeType PlaneCount = 6;
+
+        [[nodiscard]] constexpr explicit
+        Frustum(const Matrix4T<T>& viewProjection) noexcept
+        {
+            const Vector4T<T>& w = viewProjection[3];
+            SetPlane(0, w + viewProjection[0]);
+            SetPlane(1, w - viewProjection[0]);
+            SetPlane(2, w + viewProjection[1]);
+            SetPlane(3, w - viewProjection[1]);
+            SetPlane(4, viewProjection[2]);
+            SetPlane(5, w - viewProjection[2]);
+        }
+
+        template <Vector4T<T> BottomRow>
+        [[nodiscard]] constexpr explicit
+        Frustum(const Transform3T<T, BottomRow>& viewProjection) noexcept
+            : Frustum(viewProjection.ToMatrix())
+        {}
+
+        // Note(3011): The projection comes from PerspectiveProjection, whose
+        // bottom row differs from the one of the view, so the two cannot be
+        // multiplied as transforms.
+        template <Vector4T<T> ProjectionRow, Vector4T<T> ViewRow>
+        [[nodiscard]] constexpr
+        Frustum(const Transform3T<T, ProjectionRow>& projection, const Transform3T<T, ViewRow>& view) noexcept
+            : Frustum(projection.ToMatrix() * view.ToMatrix())
+        {}
+
+        [[nodiscard]] constexpr
+        Vector4T<T> GetPlane(SizeType index) const noexcept
+        {
+            return Vector4T<T>(NormalX[index], NormalY[index], NormalZ[index], Offset[index]);
+        }
+
+        LaneType NormalX;
+        LaneType NormalY;
+        LaneType NormalZ;
+        LaneType Offset;
+    private:
+        constexpr
+        void SetPlane(SizeType index, const Vector4T<T>& plane) noexcept
+        {
+            T inverseLength = Cast<T>(1) / Sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+            NormalX[index] = plane.x * inverseLength;
+            NormalY[index] = plane.y * inverseLength;
+            NormalZ[index] = plane.z * inverseLength;
+            Offset[index] = plane.w * inverseLength;
+        }
+    };
+
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    bool Contains(const Frustum<T>& frustum, const Point<T>& point) noexcept
+    {
+        bool inside = true;
+        for (SizeType i = 0; i < Frustum<T>::PlaneCount; ++i)
+        {
+            inside &= frustum.NormalX[i] * point.x + frustum.NormalY[i] * point.y + frustum.NormalZ[i] * point.z + frustum.Offset[i] >= Cast<T>(0);
+        }
+        return inside;
+    }
+
+    // Note(3011): All six planes are tested without stopping early, which
+    // keeps the batch loops below free of branches.
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    bool Overlaps(const Frustum<T>& frustum, const Sphere<T>& sphere) noexcept
+    {
+        bool inside = true;
+        for (SizeType i = 0; i < Frustum<T>::PlaneCount; ++i)
+        {
+            T distance = frustum.NormalX[i] * sphere.Center.x + frustum.NormalY[i] * sphere.Center.y + frustum.NormalZ[i] * sphere.Center.z + frustum.Offset[i];
+            inside &= distance >= -sphere.Radius;
+        }
+        return inside;
+    }
+
+    // Note(3011): The distance of the box center against the projection of
+    // its half extent on the plane normal, the corner furthest along the
+    // normal without selecting it.
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    bool Overlaps(const Frustum<T>& frustum, const Box<T>& box) noexcept
+    {
+        T centerX = (box.Min.x + box.Max.x) * Cast<T>(0.5);
+        T centerY = (box.Min.y + box.Max.y) * Cast<T>(0.5);
+        T centerZ = (box.Min.z + box.Max.z) * Cast<T>(0.5);
+        T extentX = (box.Max.x - box.Min.x) * Cast<T>(0.5);
+        T extentY = (box.Max.y - box.Min.y) * Cast<T>(0.5);
+        T extentZ = (box.Max.z - box.Min.z) * Cast<T>(0.5);
+
+        bool inside = true;
+        for (SizeType i = 0; i < Frustum<T>::PlaneCount; ++i)
+        {
+            T distance = frustum.NormalX[i] * centerX + frustum.NormalY[i] * centerY + frustum.NormalZ[i] * centerZ + frustum.Offset[i];
+            T radius = Abs(frustum.NormalX[i]) * extentX + Abs(frustum.NormalY[i]) * extentY + Abs(frustum.NormalZ[i]) * extentZ;
+            inside &= distance >= -radius;
+        }
+        return inside;
+    }
+
+    // Note(3011): visible[i] is whether shapes[i] may be seen. Only as many
+    // shapes as visible can hold are culled.
+    template <Concept::StrongFloatType T, typename Shape>
+        requires requires (const Frustum<T>& frustum, const Shape& shape) { { Overlaps(frustum, shape) } -> Concept::IsSame<bool>; }
+    constexpr
+    void Cull(const Frustum<T>& frustum, std::span<const Shape> shapes, std::span<bool> visible) noexcept
+    {
+        SizeType count = Min(SizeType(shapes.size()), SizeType(visible.size()));
+        for (SizeType i = 0; i < count; ++i)
+        {
+            visible[ToUnderlying(i)] = Overlaps(frustum, shapes[ToUnderlying(i)]);
+        }
+    }
+
+    // Note(3011): Writes the indices of the shapes that may be seen, in
+    // order, to the front of indices and returns how many there are. Only as
+    // many shapes as indices can hold are culled. Every index is written and
+    // the count only advances past the visible ones, so there is no branch.
+    template <Concept::StrongFloatType T, typename Shape>
+        requires requires (const Frustum<T>& frustum, const Shape& shape) { { Overlaps(frustum, shape) } -> Concept::IsSame<bool>; }
+    constexpr
+    SizeType Cull(const Frustum<T>& frustum, std::span<const Shape> shapes, std::span<u32> indices) noexcept
+    {
+        SizeType culled = Min(SizeType(shapes.size()), SizeType(indices.size()));
+        SizeType count = 0;
+        for (SizeType i = 0; i < culled; ++i)
+        {
+            indices[ToUnderlying(count)] = Cast<u32>(i);
+            count += Overlaps(frustum, shapes[ToUnderlying(i)]) ? SizeType(1) : SizeType(0);
+        }
+        return count;
+    }
+}
+
+#endif //MATHLIB_IMPLEMENTATION_GEOMETRY_FRUSTUM_HPP
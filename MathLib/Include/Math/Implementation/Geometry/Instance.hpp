@@ -0,0 +1,161 @@
+#ifndef MATHLIB_IMPLEMENTATION_GEOMETRY_INSTANCE_HPP
+#define MATHLIB_IMPLEMENTATION_GEOMETRY_INSTANCE_HPP
+
+// Note(3011):
+// A shape placed in the world by an affine transform, without copying it. A
+// heavy mesh, or a BVH wrapped together with its primitives, can be placed
+// many times. Rays are moved into object space by the cached inverse. The
+// direction is not normalized there, so the distance along the object space
+// ray is the distance along the world ray and hits need no mapping. Normals
+// are mapped back with the inverse transpose.
+//
+// The shape is used through NearestIntersection, AnyIntersection and
+// BoundingBox when those exist for it, otherwise through its members
+// NearestIntersection, HasIntersection and Bounds, like for TriangleMesh and
+// SphereSet.
+
+#include "AnyIntersections.hpp"
+#include "Bounds.hpp"
+#include "Intersections.hpp"
+
+namespace Math::Geometry
+{
+    template <Concept::StrongFloatType T, typename Shape>
+    class Instance final
+    {
+    public:
+        using ScalarType = T;
+        using PointType = Point<T>;
+        using VectorType = Vector3T<T>;
+        using ShapeType = Shape;
+
+        // Note(3011): Only a reference to the shape is kept, it has to
+        // outlive the instance.
+        [[nodiscard]] constexpr
+        Instance(const Shape& shape, const Transform3T<T>& transform) noexcept
+            : mShape(&shape), mTransform(transform), mInverse(Invert(transform))
+        {}
+
+        [[nodiscard]] constexpr
+        const Shape& GetShape() const noexcept
+        {
+            return *mShape;
+        }
+
+        [[nodiscard]] constexpr
+        const Transform3T<T>& GetTransform() const noexcept
+        {
+            return mTransform;
+        }
+
+        [[nodiscard]] constexpr
+        const Transform3T<T>& GetInverse() const noexcept
+        {
+            return mInverse;
+        }
+
+        [[nodiscard]] constexpr
+        Ray<T> ToObjectSpace(const Ray<T>& ray) const noexcept
+        {
+            return Ray<T>(mInverse * ray.Origin, mInverse * ray.Direction);
+        }
+
+        [[nodiscard]] constexpr
+        PointType ToObjectSpace(const PointType& point) const noexcept
+        {
+            return mInverse * point;
+        }
+
+        [[nodiscard]] constexpr
+        PointType ToWorldSpace(const PointType& point) const noexcept
+        {
+            return mTransform * point;
+        }
+
+        // Note(3011): Multiplies by the transpose of the inverse, so normals
+        // stay perpendicular to the surface under non uniform scaling. The
+        // length changes, the result is not normalized.
+        [[nodiscard]] constexpr
+        VectorType NormalToWorldSpace(const VectorType& normal) const noexcept
+        {
+            return normal * mInverse;
+        }
+
+        // Note(3011): Normalized, whether the normal of the shape is or not.
+        [[nodiscard]] constexpr
+        VectorType SurfaceNormal(const PointType& surfacePoint) const noexcept
+            requires requires (const Shape& shape, const PointType& point) { { shape.SurfaceNormal(point) } -> Concept::IsSame<VectorType>; }
+        {
+            return Normalize(NormalToWorldSpace(mShape->SurfaceNormal(ToObjectSpace(surfacePoint))));
+        }
+    private:
+        const Shape* mShape;
+        Transform3T<T> mTransform;
+        Transform3T<T> mInverse;
+    };
+
+    // Note(3011): Returns what the shape returns, a TriangleMesh::Hit stays
+    // one. The distance is already the one along the world ray.
+    template <Concept::StrongFloatType T, typename Shape>
+    [[nodiscard]] constexpr
+    auto NearestIntersection(const Ray<T>& ray, const Interval<T>& interval, const Instance<T, Shape>& instance) noexcept
+    {
+        Ray<T> objectRay = instance.ToObjectSpace(ray);
+        if constexpr (requires { NearestIntersection(objectRay, interval, instance.GetShape()); })
+        {
+            return NearestIntersection(objectRay, interval, instance.GetShape());
+        }
+        else
+        {
+            return instance.GetShape().NearestIntersection(objectRay, interval);
+        }
+    }
+
+    template <Concept::StrongFloatType T, typename Shape>
+    [[nodiscard]] constexpr
+    bool AnyIntersection(const Ray<T>& ray, const Interval<T>& interval, const Instance<T, Shape>& instance) noexcept
+    {
+        Ray<T> objectRay = instance.ToObjectSpace(ray);
+        if constexpr (requires { AnyIntersection(objectRay, interval, instance.GetShape()); })
+        {
+            return AnyIntersection(objectRay, interval, instance.GetShape());
+        }
+        else if constexpr (requires { instance.GetShape().HasIntersection(objectRay, interval); })
+        {
+            return instance.GetShape().HasIntersection(objectRay, interval);
+        }
+        else
+        {
+            return NearestIntersection(ray, interval, instance).IsValid();
+        }
+    }
+
+    // Note(3011): The transformed box of the shape's box, which is larger
+    // than needed under rotation, but needs no access to the primitives. An
+    // unbounded shape, like a plane, stays unbounded.
+    template <Concept::StrongFloatType T, typename Shape>
+    [[nodiscard]] constexpr
+    Box<T> BoundingBox(const Instance<T, Shape>& instance) noexcept
+    {
+        Box<T> box = [&]()
+        {
+            if constexpr (requires { BoundingBox(instance.GetShape()); })
+            {
+                return BoundingBox(instance.GetShape());
+            }
+            else
+            {
+                return instance.GetShape().Bounds();
+            }
+        }();
+
+        Vector3T<T> extent = box.Max - box.Min;
+        if (!(extent.x < T::Infinity() && extent.y < T::Infinity() && extent.z < T::Infinity()))
+        {
+            return Box<T>(Point<T>(-T::Infinity()), Point<T>(T::Infinity()));
+        }
+        return BoundingBox(instance.GetTransform(), box);
+    }
+}
+
+#endif //MATHLIB_IMPLEMENTATION_GEOMETRY_INSTANCE_HPP
@@ -81,33 +81,79 @@ namespace Math::Geometry
         }
     }
 
+    // Note(3011): A ray whose direction is normalized. The constructor
+    // normalizes it, distances along it are then in world units.
     template <Concept::StrongFloatType T>
-    [[nodiscard]] constexpr
-    Intersection<T> NearestIntersection(const Ray<T>& ray, const Interval<T>& interval, const Sphere<T>& sphere) noexcept
+    struct UnitRay : public Ray<T>
     {
-        using Float = T;
-        using VectorType = typename Ray<T>::VectorType;
+    public:
+        [[nodiscard]] constexpr explicit
+        UnitRay(const Ray<T>& ray) noexcept
+            : Ray<T>(ray.Origin, Normalize(ray.Direction))
+        {}
+    };
+}
 
-        auto newOrigin = ray.Origin - sphere.Center;
+namespace Math::Geometry::Implementation
+{
+    // Note(3011): Roots of |f + t * d|^2 = r^2 for f = origin - center, the
+    // stable way of Ray Tracing Gems, chapter 7. The discriminant is taken
+    // from the distance between the center and the line (Hearn and Baker)
+    // instead of b^2 - ac, which cancels for spheres far away. The root not
+    // suffering from cancellation is computed first and gives the other one
+    // through c / q. Both roots are always written, the result says if they
+    // are real. With Unit, d must be normalized and a = 1 is left out.
+    template <bool Unit, Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    bool SphereRoots(T fx, T fy, T fz, T dx, T dy, T dz, T radius2, T& t0, T& t1) noexcept
+    {
+        T a = Unit ? Cast<T>(1) : dx * dx + dy * dy + dz * dz;
+        T b = -(fx * dx + fy * dy + fz * dz);
+        T scale = Unit ? b : b / a;
+        T lx = fx + scale * dx;
+        T ly = fy + scale * dy;
+        T lz = fz + scale * dz;
+        T discriminant = radius2 - (lx * lx + ly * ly + lz * lz);
+        T c = (fx * fx + fy * fy + fz * fz) - radius2;
+
+        T root = Sqrt(Max(Unit ? discriminant : a * discriminant, Cast<T>(0)));
+        T q = b < Cast<T>(0) ? b - root : b + root;
+        t0 = c / q;
+        t1 = Unit ? q : q / a;
+        return discriminant >= Cast<T>(0);
+    }
+}
 
-        Float a = ray.Direction.LenSqr();
-        Float b = 2 * Dot(VectorType(Cast<Float>(1)), ray.Direction * newOrigin);
-        Float c = newOrigin.LenSqr() - Squared(sphere.Radius);
+namespace Math::Geometry
+{
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    Intersection<T> NearestIntersection(const Ray<T>& ray, const Interval<T>& interval, const Sphere<T>& sphere) noexcept
+    {
+        Vector3T<T> f = ray.Origin - sphere.Center;
+        T t0;
+        T t1;
+        if (!Implementation::SphereRoots<false>(f.x, f.y, f.z, ray.Direction.x, ray.Direction.y, ray.Direction.z, Squared(sphere.Radius), t0, t1))
+        {
+            return Intersection<T>(T::NaN());
+        }
 
-        Float discriminant = Squared(b) - 4 * a * c;
+        return Intersection<T>(interval.Pick(t0, t1));
+    }
 
-        if (discriminant < Cast<Float>(0))
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    Intersection<T> NearestIntersection(const UnitRay<T>& ray, const Interval<T>& interval, const Sphere<T>& sphere) noexcept
+    {
+        Vector3T<T> f = ray.Origin - sphere.Center;
+        T t0;
+        T t1;
+        if (!Implementation::SphereRoots<true>(f.x, f.y, f.z, ray.Direction.x, ray.Direction.y, ray.Direction.z, Squared(sphere.Radius), t0, t1))
         {
-            return Float::NaN();
+            return Intersection<T>(T::NaN());
         }
 
-        Float discriminantSqrt = Sqrt(discriminant);
-        Float a2 = Cast<T>(2) * a;
-        Float t0 = (-b + discriminantSqrt) / a2;
-        Float t1 = (-b - discriminantSqrt) / a2;
-
-        Float distance = interval.Pick(t0, t1);
-        return Intersection<Float>(distance);
+        return Intersection<T>(interval.Pick(t0, t1));
     }
 }
 
@@ -0,0 +1,234 @@
+#ifndef MATHLIB_IMPLEMENTATION_GEOMETRY_RAY_PACKET_HPP
+#define MATHLIB_IMPLEMENTATION_GEOMETRY_RAY_PACKET_HPP
+
+// Note(3011):
+// N rays stored component by component, so that intersecting all of them
+// with one shape is a loop over plain arrays. The loops below compute every
+// lane without branching and select the results at the end, the compiler
+// turns them into vector code for the instruction set it targets, no
+// intrinsics needed. Lanes that are not active, or that miss, come out NaN.
+// The distances equal the ones of the single ray NearestIntersection.
+
+#include "../Base/Array.hpp"
+#include "BoxIntersections.hpp"
+#include "Intersections.hpp"
+
+#include <span>
+
+namespace Math::Geometry
+{
+    template <Concept::StrongFloatType T, SizeType N>
+    struct RayPacket
+    {
+    public:
+        using ScalarType = T;
+        using LaneType = Array<T, N>;
+
+        static constexpr SizeType Width = N;
+
+        [[nodiscard]] constexpr
+        RayPacket() noexcept = default;
+
+        // Note(3011): Lanes beyond the end of rays stay inactive.
+        [[nodiscard]] constexpr explicit
+        RayPacket(std::span<const Ray<T>> rays, const Interval<T>& interval = {}) noexcept
+        {
+            for (SizeType lane = 0; lane < Min(N, SizeType(rays.size())); ++lane)
+            {
+                Set(lane, rays[ToUnderlying(lane)], interval);
+            }
+        }
+
+        constexpr
+        void Set(SizeType lane, const Ray<T>& ray, const Interval<T>& interval = {}) noexcept
+        {
+            OriginX[lane] = ray.Origin.x;
+            OriginY[lane] = ray.Origin.y;
+            OriginZ[lane] = ray.Origin.z;
+            DirectionX[lane] = ray.Direction.x;
+            DirectionY[lane] = ray.Direction.y;
+            DirectionZ[lane] = ray.Direction.z;
+            IntervalMin[lane] = interval.Min;
+            IntervalMax[lane] = interval.Max;
+            Active[lane] = true;
+        }
+
+        [[nodiscard]] constexpr
+        Ray<T> GetRay(SizeType lane) const noexcept
+        {
+            return Ray<T>(Point<T>(OriginX[lane], OriginY[lane], OriginZ[lane]), Vector3T<T>(DirectionX[lane], DirectionY[lane], DirectionZ[lane]));
+        }
+
+        [[nodiscard]] constexpr
+        Interval<T> GetInterval(SizeType lane) const noexcept
+        {
+            return Interval<T>(IntervalMin[lane], IntervalMax[lane]);
+        }
+
+        [[nodiscard]] constexpr
+        bool AnyActive() const noexcept
+        {
+            bool any = false;
+            for (SizeType lane = 0; lane < N; ++lane)
+            {
+                any |= Active[lane];
+            }
+            return any;
+        }
+
+        LaneType OriginX;
+        LaneType OriginY;
+        LaneType OriginZ;
+        LaneType DirectionX;
+        LaneType DirectionY;
+        LaneType DirectionZ;
+        LaneType IntervalMin;
+        LaneType IntervalMax;
+        Array<bool, N> Active;
+    };
+
+    template <Concept::StrongFloatType T>
+    using RayPacket4 = RayPacket<T, 4>;
+
+    template <Concept::StrongFloatType T>
+    using RayPacket8 = RayPacket<T, 8>;
+}
+
+namespace Math::Geometry::Implementation
+{
+    // Note(3011): Interval::Pick for one lane, as selects instead of returns.
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    T PickLane(T min, T max, T t) noexcept
+    {
+        return (min <= t && t <= max) ? t : T::NaN();
+    }
+
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    T PickLane(T min, T max, T t0, T t1) noexcept
+    {
+        T near = Min(t0, t1);
+        T far = Max(t0, t1);
+        return (min <= near && near <= max) ? near : PickLane(min, max, far);
+    }
+}
+
+namespace Math::Geometry
+{
+    template <Concept::StrongFloatType T, SizeType N>
+    [[nodiscard]] constexpr
+    Array<T, N> NearestIntersection(const RayPacket<T, N>& packet, const Plane<T>& plane) noexcept
+    {
+        T epsilon = Constant::GeometryEpsilon<T>;
+        Array<T, N> distances;
+        for (SizeType lane = 0; lane < N; ++lane)
+        {
+            T cosIncidence = packet.DirectionX[lane] * plane.Normal.x + packet.DirectionY[lane] * plane.Normal.y + packet.DirectionZ[lane] * plane.Normal.z;
+            T offset = plane.Normal.x * (plane.Origin.x - packet.OriginX[lane])
+                     + plane.Normal.y * (plane.Origin.y - packet.OriginY[lane])
+                     + plane.Normal.z * (plane.Origin.z - packet.OriginZ[lane]);
+
+            T distance = Implementation::PickLane(packet.IntervalMin[lane], packet.IntervalMax[lane], offset / cosIncidence);
+            T parallel = Abs(offset) < epsilon ? Cast<T>(0) : T::NaN();
+            distance = Abs(cosIncidence) < epsilon ? parallel : distance;
+            distances[lane] = packet.Active[lane] ? distance : T::NaN();
+        }
+        return distances;
+    }
+
+    template <Concept::StrongFloatType T, SizeType N>
+    [[nodiscard]] constexpr
+    Array<T, N> NearestIntersection(const RayPacket<T, N>& packet, const Triangle<T>& triangle) noexcept
+    {
+        using VectorType = Vector3T<T>;
+
+        Array<T, N> distances;
+        for (SizeType lane = 0; lane < N; ++lane)
+        {
+            distances[lane] = T::NaN();
+        }
+
+        // Note(3011): Everything that only depends on the triangle is shared
+        // by the lanes.
+        VectorType u = triangle.B - triangle.A;
+        VectorType v = triangle.C - triangle.A;
+        VectorType normal = Cross(u, v);
+        if (Equal(normal, VectorType(Cast<T>(0))))
+        {
+            return distances;
+        }
+
+        T epsilon = Constant::GeometryEpsilon<T>;
+        T uv = Dot(u, v);
+        T uu = u.LenSqr();
+        T vv = v.LenSqr();
+        T det = Squared(uv) - uu * vv;
+
+        for (SizeType lane = 0; lane < N; ++lane)
+        {
+            T ax = packet.OriginX[lane] - triangle.A.x;
+            T ay = packet.OriginY[lane] - triangle.A.y;
+            T az = packet.OriginZ[lane] - triangle.A.z;
+            T a = -(normal.x * ax + normal.y * ay + normal.z * az);
+            T b = normal.x * packet.DirectionX[lane] + normal.y * packet.DirectionY[lane] + normal.z * packet.DirectionZ[lane];
+            T distance = a / b;
+
+            T wx = (packet.OriginX[lane] + distance * packet.DirectionX[lane]) - triangle.A.x;
+            T wy = (packet.OriginY[lane] + distance * packet.DirectionY[lane]) - triangle.A.y;
+            T wz = (packet.OriginZ[lane] + distance * packet.DirectionZ[lane]) - triangle.A.z;
+            T uw = u.x * wx + u.y * wy + u.z * wz;
+            T vw = v.x * wx + v.y * wy + v.z * wz;
+            T s = (uv * vw - vv * uw) / det;
+            T t = (uv * uw - uu * vw) / det;
+
+            bool inside = s > Cast<T>(0) && t > Cast<T>(0) && (s + t) <= Cast<T>(1) && distance >= Cast<T>(0);
+            T hit = inside ? Implementation::PickLane(packet.IntervalMin[lane], packet.IntervalMax[lane], distance) : T::NaN();
+            T parallel = Abs(a) < epsilon ? Cast<T>(0) : T::NaN();
+            hit = Abs(b) < epsilon ? parallel : hit;
+            distances[lane] = packet.Active[lane] ? hit : T::NaN();
+        }
+        return distances;
+    }
+
+    template <Concept::StrongFloatType T, SizeType N>
+    [[nodiscard]] constexpr
+    Array<T, N> NearestIntersection(const RayPacket<T, N>& packet, const Sphere<T>& sphere) noexcept
+    {
+        T radius2 = Squared(sphere.Radius);
+        Array<T, N> distances;
+        for (SizeType lane = 0; lane < N; ++lane)
+        {
+            T t0;
+            T t1;
+            bool real = Implementation::SphereRoots<false>(
+                packet.OriginX[lane] - sphere.Center.x, packet.OriginY[lane] - sphere.Center.y, packet.OriginZ[lane] - sphere.Center.z,
+                packet.DirectionX[lane], packet.DirectionY[lane], packet.DirectionZ[lane], radius2, t0, t1);
+
+            T distance = Implementation::PickLane(packet.IntervalMin[lane], packet.IntervalMax[lane], t0, t1);
+            distances[lane] = (packet.Active[lane] && real) ? distance : T::NaN();
+        }
+        return distances;
+    }
+
+    template <Concept::StrongFloatType T, SizeType N>
+    [[nodiscard]] constexpr
+    Array<T, N> NearestIntersection(const RayPacket<T, N>& packet, const Box<T>& box) noexcept
+    {
+        Array<T, N> distances;
+        for (SizeType lane = 0; lane < N; ++lane)
+        {
+            T entry = -T::Infinity();
+            T exit = T::Infinity();
+            Implementation::ClipSlab(box.Min.x, box.Max.x, packet.OriginX[lane], Cast<T>(1) / packet.DirectionX[lane], entry, exit);
+            Implementation::ClipSlab(box.Min.y, box.Max.y, packet.OriginY[lane], Cast<T>(1) / packet.DirectionY[lane], entry, exit);
+            Implementation::ClipSlab(box.Min.z, box.Max.z, packet.OriginZ[lane], Cast<T>(1) / packet.DirectionZ[lane], entry, exit);
+
+            T distance = Implementation::PickLane(packet.IntervalMin[lane], packet.IntervalMax[lane], entry, exit);
+            distances[lane] = (packet.Active[lane] && entry <= exit) ? distance : T::NaN();
+        }
+        return distances;
+    }
+}
+
+#endif //MATHLIB_IMPLEMENTATION_GEOMETRY_RAY_PACKET_HPP
@@ -82,6 +82,7 @@ namespace Math::Geometry
     struct Box
     {
     public:
+        using ScalarType = T;
         using PointType = Point<T>;
 
         [[nodiscard]] constexpr
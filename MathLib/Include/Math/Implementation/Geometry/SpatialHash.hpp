@@ -0,0 +1,515 @@
+#ifndef MATHLIB_IMPLEMENTATION_GEOMETRY_SPATIAL_HASH_HPP
+#define MATHLIB_IMPLEMENTATION_GEOMETRY_SPATIAL_HASH_HPP
+
+// Note(3011):
+// Broad phase for 2D and 3D points. Space is cut into cubic cells and every
+// point goes into the bucket of its cell. UniformGrid covers a fixed region
+// with one bucket per cell, SpatialHash covers all of space and hashes the
+// cells into a table. The buckets are built with a counting sort into one
+// contiguous array instead of a vector per cell, rebuilding every frame
+// reuses the storage of the previous one. Points keep their input order
+// within a bucket.
+
+#include "../Base/Array.hpp"
+#include "../../Point.hpp"
+
+#include <algorithm>
+#include <span>
+#include <vector>
+
+namespace Math::Geometry
+{
+    template <Concept::BasicPoint PointType, typename Payload>
+    struct Neighbor
+    {
+        PointType Position;
+        Payload Value;
+        typename PointType::ScalarType DistanceSquared;
+    };
+}
+
+namespace Math::Geometry::Implementation
+{
+    // Note(3011): Points and payloads sorted by bucket, the entries of
+    // bucket b are [Start(b), Start(b + 1)).
+    template <Concept::BasicPoint PointType, typename Payload>
+    class BucketTable final
+    {
+    public:
+        template <typename BucketOf, typename PayloadOf>
+        void Build(std::span<const PointType> points, SizeType bucketCount, BucketOf&& bucketOf, PayloadOf&& payloadOf)
+        {
+            mStart.assign(ToUnderlying(bucketCount) + 1, u32(0));
+            mBuckets.resize(points.size());
+            for (SizeType i = 0; i < SizeType(points.size()); ++i)
+            {
+                u32 bucket = Cast<u32>(bucketOf(points[ToUnderlying(i)]));
+                mBuckets[ToUnderlying(i)] = bucket;
+                ++mStart[ToUnderlying(bucket) + 1];
+            }
+
+            for (SizeType bucket = 1; bucket <= bucketCount; ++bucket)
+            {
+                mStart[ToUnderlying(bucket)] += mStart[ToUnderlying(bucket) - 1];
+            }
+
+            mCursor.assign(mStart.begin(), mStart.end() - 1);
+            mPoints.resize(points.size());
+            mPayloads.resize(points.size());
+            for (SizeType i = 0; i < SizeType(points.size()); ++i)
+            {
+                u32 target = mCursor[ToUnderlying(mBuckets[ToUnderlying(i)])]++;
+                mPoints[ToUnderlying(target)] = points[ToUnderlying(i)];
+                mPayloads[ToUnderlying(target)] = payloadOf(i);
+            }
+        }
+
+        [[nodiscard]]
+        SizeType Count() const noexcept
+        {
+            return SizeType(mPoints.size());
+        }
+
+        [[nodiscard]]
+        SizeType BucketCount() const noexcept
+        {
+            return mStart.empty() ? SizeType(0) : SizeType(mStart.size() - 1);
+        }
+
+        [[nodiscard]]
+        SizeType Start(SizeType bucket) const noexcept
+        {
+            return Cast<SizeType>(mStart[ToUnderlying(bucket)]);
+        }
+
+        [[nodiscard]]
+        const PointType& GetPoint(SizeType entry) const noexcept
+        {
+            return mPoints[ToUnderlying(entry)];
+        }
+
+        [[nodiscard]]
+        const Payload& GetPayload(SizeType entry) const noexcept
+        {
+            return mPayloads[ToUnderlying(entry)];
+        }
+    private:
+        std::vector<u32> mStart;
+        std::vector<u32> mBuckets;
+        std::vector<u32> mCursor;
+        std::vector<PointType> mPoints;
+        std::vector<Payload> mPayloads;
+    };
+
+    template <Concept::BasicPoint PointType>
+    [[nodiscard]] constexpr
+    bool WithinRadius(const PointType& point, const PointType& center, typename PointType::ScalarType radiusSquared) noexcept
+    {
+        return (point - center).LenSqr() <= radiusSquared;
+    }
+
+    // Note(3011): Radius queries with a doubling radius, until at least k
+    // points are within it. Then the k nearest are among them. The search
+    // also ends once the radius no longer grows, for points no finite
+    // radius reaches.
+    template <typename Structure, Concept::BasicPoint PointType>
+    [[nodiscard]]
+    auto NearestNeighbors(const Structure& structure, const PointType& point, SizeType k, typename PointType::ScalarType radius)
+    {
+        using T = typename PointType::ScalarType;
+        using NeighborType = typename Structure::NeighborType;
+
+        std::vector<NeighborType> neighbors;
+        k = Min(k, structure.Count());
+        if (k == SizeType(0))
+        {
+            return neighbors;
+        }
+
+        while (true)
+        {
+            neighbors.clear();
+            structure.ForEachInRadius(point, radius, [&](const PointType& position, const auto& payload)
+            {
+                neighbors.push_back({ position, payload, (position - point).LenSqr() });
+            });
+
+            if (SizeType(neighbors.size()) >= k || !(radius < T::Max()))
+            {
+                break;
+            }
+            radius = radius * Cast<T>(2);
+        }
+
+        k = Min(k, SizeType(neighbors.size()));
+        std::partial_sort(neighbors.begin(), neighbors.begin() + ToUnderlying(k), neighbors.end(), [](const NeighborType& a, const NeighborType& b)
+        {
+            return a.DistanceSquared < b.DistanceSquared;
+        });
+        neighbors.resize(ToUnderlying(k));
+        return neighbors;
+    }
+}
+
+namespace Math::Geometry
+{
+    // Note(3011): Cells cover [min, max] and points outside of it go into
+    // the nearest border cell, so they are still found, only slower. An axis
+    // has at most MaxResolution cells, which keeps the grid below
+    // MaxCellCount buckets. A cell size that would need more cells only
+    // applies up to that limit, beyond it the cells of the axis grow to
+    // split [min, max] into MaxResolution cells.
+    template <Concept::BasicPoint PointType, typename Payload = u32>
+    class UniformGrid final
+    {
+    public:
+        using ScalarType = typename PointType::ScalarType;
+        using NeighborType = Neighbor<PointType, Payload>;
+
+        static constexpr SizeType Dimension = PointType::Dimension;
+        static constexpr SizeType MaxCellCount = SizeType(1) << SizeType(24);
+        static constexpr SizeType MaxResolution = SizeType(1) << (SizeType(24) / Dimension);
+
+        // Note(3011): A single cell, [0, 1] along every axis.
+        [[nodiscard]]
+        UniformGrid() noexcept
+            : UniformGrid(PointType(Cast<ScalarType>(0)), PointType(Cast<ScalarType>(1)), Cast<ScalarType>(1))
+        {}
+
+        // Note(3011): cellSize has to be positive.
+        [[nodiscard]]
+        UniformGrid(const PointType& min, const PointType& max, ScalarType cellSize) noexcept
+            : mMin(min)
+        {
+            for (SizeType axis = 0; axis < Dimension; ++axis)
+            {
+                ScalarType extent = max[axis] - min[axis];
+                ScalarType cells = extent / cellSize;
+                if (!(cells > Cast<ScalarType>(1)))
+                {
+                    mResolution[axis] = 1;
+                    mInverseCellSize[axis] = Cast<ScalarType>(1) / cellSize;
+                }
+                else if (cells > Cast<ScalarType>(MaxResolution))
+                {
+                    mResolution[axis] = MaxResolution;
+                    mInverseCellSize[axis] = Cast<ScalarType>(MaxResolution) / extent;
+                }
+                else
+                {
+                    mResolution[axis] = Cast<SizeType>(Ceil<i64>(cells));
+                    mInverseCellSize[axis] = Cast<ScalarType>(1) / cellSize;
+                }
+            }
+        }
+
+        [[nodiscard]]
+        SizeType Count() const noexcept
+        {
+            return mTable.Count();
+        }
+
+        [[nodiscard]]
+        const Array<SizeType, Dimension>& Resolution() const noexcept
+        {
+            return mResolution;
+        }
+
+        // Note(3011): Points without a payload, past the end of payloads,
+        // are left out.
+        void Build(std::span<const PointType> points, std::span<const Payload> payloads)
+        {
+            points = points.first(ToUnderlying(Min(SizeType(points.size()), SizeType(payloads.size()))));
+            mTable.Build(points, CellCount(), [&](const PointType& point) { return Bucket(point); },
+                         [&](SizeType i) { return payloads[ToUnderlying(i)]; });
+        }
+
+        // Note(3011): The payload of every point is its index.
+        void Build(std::span<const PointType> points) requires Concept::IsSame<Payload, u32>
+        {
+            mTable.Build(points, CellCount(), [&](const PointType& point) { return Bucket(point); },
+                         [](SizeType i) { return Cast<u32>(i); });
+        }
+
+        // Note(3011): Calls visit(point, payload) for every point within
+        // radius of center, bucket by bucket. Along the first axis the
+        // buckets of a row are contiguous and read in one go.
+        template <typename Visitor>
+        void ForEachInRadius(const PointType& center, ScalarType radius, Visitor&& visit) const
+        {
+            if (Count() == SizeType(0))
+            {
+                return;
+            }
+
+            Array<SizeType, Dimension> low;
+            Array<SizeType, Dimension> high;
+            for (SizeType axis = 0; axis < Dimension; ++axis)
+            {
+                low[axis] = Cell(center[axis] - radius, axis);
+                high[axis] = Cell(center[axis] + radius, axis);
+            }
+
+            ScalarType radiusSquared = radius * radius;
+            Array<SizeType, Dimension> cell = low;
+            while (true)
+            {
+                cell[0] = low[0];
+                SizeType first = Bucket(cell);
+                SizeType begin = mTable.Start(first);
+                SizeType end = mTable.Start(first + high[0] - low[0] + SizeType(1));
+                for (SizeType entry = begin; entry < end; ++entry)
+                {
+                    if (Implementation::WithinRadius(mTable.GetPoint(entry), center, radiusSquared))
+                    {
+                        visit(mTable.GetPoint(entry), mTable.GetPayload(entry));
+                    }
+                }
+
+                SizeType axis = 1;
+                while (axis < Dimension && cell[axis] == high[axis])
+                {
+                    cell[axis] = low[axis];
+                    ++axis;
+                }
+                if (axis == Dimension)
+                {
+                    break;
+                }
+                ++cell[axis];
+            }
+        }
+
+        // Note(3011): The k points nearest to point, nearest first. Fewer
+        // when the grid holds fewer. The search starts from the cell size
+        // of the first axis, which is larger than the requested one when
+        // the resolution was capped.
+        [[nodiscard]]
+        std::vector<NeighborType> Nearest(const PointType& point, SizeType k) const
+        {
+            return Implementation::NearestNeighbors(*this, point, k, Cast<ScalarType>(1) / mInverseCellSize[0]);
+        }
+    private:
+        [[nodiscard]]
+        SizeType CellCount() const noexcept
+        {
+            SizeType count = 1;
+            for (SizeType axis = 0; axis < Dimension; ++axis)
+            {
+                count *= mResolution[axis];
+            }
+            return count;
+        }
+
+        [[nodiscard]]
+        SizeType Cell(ScalarType coordinate, SizeType axis) const noexcept
+        {
+            ScalarType cell = Clamp((coordinate - mMin[axis]) * mInverseCellSize[axis], Cast<ScalarType>(0), Cast<ScalarType>(mResolution[axis] - SizeType(1)));
+            return Cast<SizeType>(Floor<i64>(cell == cell ? cell : Cast<ScalarType>(0)));
+        }
+
+        [[nodiscard]]
+        SizeType Bucket(const Array<SizeType, Dimension>& cell) const noexcept
+        {
+            SizeType bucket = cell[Dimension - SizeType(1)];
+            for (SizeType axis = Dimension - SizeType(1); axis > SizeType(0); --axis)
+            {
+                bucket = bucket * mResolution[axis - SizeType(1)] + cell[axis - SizeType(1)];
+            }
+            return bucket;
+        }
+
+        [[nodiscard]]
+        SizeType Bucket(const PointType& point) const noexcept
+        {
+            Array<SizeType, Dimension> cell;
+            for (SizeType axis = 0; axis < Dimension; ++axis)
+            {
+                cell[axis] = Cell(point[axis], axis);
+            }
+            return Bucket(cell);
+        }
+
+        PointType mMin;
+        Array<ScalarType, Dimension> mInverseCellSize;
+        Array<SizeType, Dimension> mResolution;
+        Implementation::BucketTable<PointType, Payload> mTable;
+    };
+
+    // Note(3011): Unbounded, the cells are hashed into a table with a bucket
+    // count of the next power of two above the number of points. Different
+    // cells can share a bucket, so a query skips the points of a bucket that
+    // are not in the cell it looks at, which also keeps it from reporting a
+    // point twice.
+    template <Concept::BasicPoint PointType, typename Payload = u32>
+    class SpatialHash final
+    {
+    public:
+        using ScalarType = typename PointType::ScalarType;
+        using NeighborType = Neighbor<PointType, Payload>;
+
+        static constexpr SizeType Dimension = PointType::Dimension;
+
+        [[nodiscard]]
+        SpatialHash() noexcept = default;
+
+        [[nodiscard]] explicit
+        SpatialHash(ScalarType cellSize) noexcept
+            : mCellSize(cellSize), mInverseCellSize(Cast<ScalarType>(1) / cellSize)
+        {}
+
+        [[nodiscard]]
+        SizeType Count() const noexcept
+        {
+            return mTable.Count();
+        }
+
+        [[nodiscard]]
+        SizeType BucketCount() const noexcept
+        {
+            return mTable.BucketCount();
+        }
+
+        // Note(3011): Points without a payload, past the end of payloads,
+        // are left out.
+        void Build(std::span<const PointType> points, std::span<const Payload> payloads)
+        {
+            points = points.first(ToUnderlying(Min(SizeType(points.size()), SizeType(payloads.size()))));
+            Resize(SizeType(points.size()));
+            mTable.Build(points, mMask + SizeType(1), [&](const PointType& point) { return Bucket(Cell(point)); },
+                         [&](SizeType i) { return payloads[ToUnderlying(i)]; });
+        }
+
+        void Build(std::span<const PointType> points) requires Concept::IsSame<Payload, u32>
+        {
+            Resize(SizeType(points.size()));
+            mTable.Build(points, mMask + SizeType(1), [&](const PointType& point) { return Bucket(Cell(point)); },
+                         [](SizeType i) { return Cast<u32>(i); });
+        }
+
+        // Note(3011): Calls visit(point, payload) for every point within
+        // radius of center. When the radius spans more cells than there are
+        // buckets, all points are tested instead.
+        template <typename Visitor>
+        void ForEachInRadius(const PointType& center, ScalarType radius, Visitor&& visit) const
+        {
+            if (Count() == SizeType(0))
+            {
+                return;
+            }
+
+            ScalarType radiusSquared = radius * radius;
+            ScalarType cells = Cast<ScalarType>(1);
+            for (SizeType axis = 0; axis < Dimension; ++axis)
+            {
+                cells = cells * (Floor((center[axis] + radius) * mInverseCellSize) - Floor((center[axis] - radius) * mInverseCellSize) + Cast<ScalarType>(1));
+            }
+
+            if (!(cells <= Cast<ScalarType>(BucketCount())))
+            {
+                for (SizeType entry = 0; entry < Count(); ++entry)
+                {
+                    if (Implementation::WithinRadius(mTable.GetPoint(entry), center, radiusSquared))
+                    {
+                        visit(mTable.GetPoint(entry), mTable.GetPayload(entry));
+                    }
+                }
+                return;
+            }
+
+            Array<i64, Dimension> low;
+            Array<i64, Dimension> high;
+            for (SizeType axis = 0; axis < Dimension; ++axis)
+            {
+                low[axis] = Floor<i64>((center[axis] - radius) * mInverseCellSize);
+                high[axis] = Floor<i64>((center[axis] + radius) * mInverseCellSize);
+            }
+
+            Array<i64, Dimension> cell = low;
+            while (true)
+            {
+                SizeType bucket = Bucket(cell);
+                for (SizeType entry = mTable.Start(bucket); entry < mTable.Start(bucket + SizeType(1)); ++entry)
+                {
+                    const PointType& point = mTable.GetPoint(entry);
+                    if (InCell(point, cell) && Implementation::WithinRadius(point, center, radiusSquared))
+                    {
+                        visit(point, mTable.GetPayload(entry));
+                    }
+                }
+
+                SizeType axis = 0;
+                while (axis < Dimension && cell[axis] == high[axis])
+                {
+                    cell[axis] = low[axis];
+                    ++axis;
+                }
+                if (axis == Dimension)
+                {
+                    break;
+                }
+                ++cell[axis];
+            }
+        }
+
+        [[nodiscard]]
+        std::vector<NeighborType> Nearest(const PointType& point, SizeType k) const
+        {
+            return Implementation::NearestNeighbors(*this, point, k, mCellSize);
+        }
+    private:
+        void Resize(SizeType count) noexcept
+        {
+            SizeType buckets = 1;
+            while (buckets < count)
+            {
+                buckets = buckets * SizeType(2);
+            }
+            mMask = buckets - SizeType(1);
+        }
+
+        [[nodiscard]]
+        Array<i64, Dimension> Cell(const PointType& point) const noexcept
+        {
+            Array<i64, Dimension> cell;
+            for (SizeType axis = 0; axis < Dimension; ++axis)
+            {
+                cell[axis] = Floor<i64>(point[axis] * mInverseCellSize);
+            }
+            return cell;
+        }
+
+        [[nodiscard]]
+        bool InCell(const PointType& point, const Array<i64, Dimension>& cell) const noexcept
+        {
+            bool inside = true;
+            for (SizeType axis = 0; axis < Dimension; ++axis)
+            {
+                inside &= Floor<i64>(point[axis] * mInverseCellSize) == cell[axis];
+            }
+            return inside;
+        }
+
+        // Note(3011): Teschner et al., "Optimized Spatial Hashing for
+        // Collision Detection of Deformable Objects".
+        [[nodiscard]]
+        SizeType Bucket(const Array<i64, Dimension>& cell) const noexcept
+        {
+            constexpr Array<u64, 3> primes(u64(73856093), u64(19349663), u64(83492791));
+
+            u64 hash = 0;
+            for (SizeType axis = 0; axis < Dimension; ++axis)
+            {
+                hash ^= Cast<u64>(cell[axis]) * primes[axis];
+            }
+            return Cast<SizeType>(hash) & mMask;
+        }
+
+        ScalarType mCellSize = Cast<ScalarType>(1);
+        ScalarType mInverseCellSize = Cast<ScalarType>(1);
+        SizeType mMask = 0;
+        Implementation::BucketTable<PointType, Payload> mTable;
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_GEOMETRY_SPATIAL_HASH_HPP
@@ -0,0 +1,172 @@
+#ifndef MATHLIB_IMPLEMENTATION_GEOMETRY_SPHERE_SET_HPP
+#define MATHLIB_IMPLEMENTATION_GEOMETRY_SPHERE_SET_HPP
+
+// Note(3011):
+// Many spheres stored component by component, intersected Lanes at a time
+// without branching. Every distance equals the one of NearestIntersection
+// for the single sphere.
+
+#include "../Base/Array.hpp"
+#include "Bounds.hpp"
+#include "Components.hpp"
+#include "Intersections.hpp"
+#include "RayPacket.hpp"
+
+#include <span>
+#include <vector>
+
+namespace Math::Geometry
+{
+    template <Concept::StrongFloatType T>
+    class SphereSet final
+    {
+    public:
+        using ScalarType = T;
+
+        struct Hit : public Intersection<T>
+        {
+        public:
+            [[nodiscard]] constexpr
+            Hit(T distance = T::NaN(), SizeType index = 0) noexcept
+                : Intersection<T>(distance), Index(index)
+            {}
+
+            SizeType Index;
+        };
+
+        static constexpr SizeType Lanes = 8;
+
+        [[nodiscard]]
+        SphereSet() noexcept = default;
+
+        // Note(3011): Padded to whole batches with NaN radii, which no ray
+        // hits.
+        [[nodiscard]] explicit
+        SphereSet(std::span<const Sphere<T>> spheres)
+            : mCount(SizeType(spheres.size()))
+        {
+            SizeType padded = (mCount + Lanes - SizeType(1)) / Lanes * Lanes;
+            mCenters.Resize(padded);
+            mRadii.assign(ToUnderlying(padded), T::NaN());
+            for (SizeType i = 0; i < mCount; ++i)
+            {
+                mCenters.Set(i, spheres[ToUnderlying(i)].Center);
+                mRadii[ToUnderlying(i)] = spheres[ToUnderlying(i)].Radius;
+            }
+        }
+
+        [[nodiscard]]
+        SizeType Count() const noexcept
+        {
+            return mCount;
+        }
+
+        [[nodiscard]]
+        Sphere<T> GetSphere(SizeType index) const noexcept
+        {
+            return Sphere<T>(mCenters.template Get<Point<T>>(index), mRadii[ToUnderlying(index)]);
+        }
+
+        // Note(3011): One box per sphere, in order, as a BVH takes them.
+        [[nodiscard]]
+        std::vector<Box<T>> Bounds() const
+        {
+            std::vector<Box<T>> bounds;
+            bounds.reserve(ToUnderlying(mCount));
+            for (SizeType i = 0; i < mCount; ++i)
+            {
+                bounds.push_back(BoundingBox(GetSphere(i)));
+            }
+            return bounds;
+        }
+
+        [[nodiscard]]
+        Hit NearestIntersection(const Ray<T>& ray, const Interval<T>& interval) const noexcept
+        {
+            return Nearest<false>(ray, interval);
+        }
+
+        [[nodiscard]]
+        Hit NearestIntersection(const UnitRay<T>& ray, const Interval<T>& interval) const noexcept
+        {
+            return Nearest<true>(ray, interval);
+        }
+
+        [[nodiscard]]
+        bool HasIntersection(const Ray<T>& ray, const Interval<T>& interval) const noexcept
+        {
+            return Any<false>(ray, interval);
+        }
+
+        [[nodiscard]]
+        bool HasIntersection(const UnitRay<T>& ray, const Interval<T>& interval) const noexcept
+        {
+            return Any<true>(ray, interval);
+        }
+    private:
+        template <bool Unit>
+        [[nodiscard]]
+        T Intersect(const Ray<T>& ray, const Interval<T>& interval, SizeType index) const noexcept
+        {
+            auto i = ToUnderlying(index);
+            T t0;
+            T t1;
+            bool real = Implementation::SphereRoots<Unit>(
+                ray.Origin.x - mCenters.X[i], ray.Origin.y - mCenters.Y[i], ray.Origin.z - mCenters.Z[i],
+                ray.Direction.x, ray.Direction.y, ray.Direction.z, Squared(mRadii[i]), t0, t1);
+            T distance = Implementation::PickLane(interval.Min, interval.Max, t0, t1);
+            return real ? distance : T::NaN();
+        }
+
+        template <bool Unit>
+        [[nodiscard]]
+        Hit Nearest(const Ray<T>& ray, const Interval<T>& interval) const noexcept
+        {
+            Hit nearest;
+            for (SizeType base = 0; base < SizeType(mRadii.size()); base += Lanes)
+            {
+                Array<T, Lanes> distances;
+                for (SizeType lane = 0; lane < Lanes; ++lane)
+                {
+                    distances[lane] = Intersect<Unit>(ray, interval, base + lane);
+                }
+
+                for (SizeType lane = 0; lane < Lanes; ++lane)
+                {
+                    if (distances[lane] < nearest.Distance || (!nearest.IsValid() && distances[lane] == distances[lane]))
+                    {
+                        nearest = Hit(distances[lane], base + lane);
+                    }
+                }
+            }
+            return nearest;
+        }
+
+        template <bool Unit>
+        [[nodiscard]]
+        bool Any(const Ray<T>& ray, const Interval<T>& interval) const noexcept
+        {
+            for (SizeType base = 0; base < SizeType(mRadii.size()); base += Lanes)
+            {
+                bool any = false;
+                for (SizeType lane = 0; lane < Lanes; ++lane)
+                {
+                    T distance = Intersect<Unit>(ray, interval, base + lane);
+                    any |= distance == distance;
+                }
+
+                if (any)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        SizeType mCount = 0;
+        Implementation::Components<T> mCenters;
+        std::vector<T> mRadii;
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_GEOMETRY_SPHERE_SET_HPP
@@ -0,0 +1,211 @@
+#ifndef MATHLIB_IMPLEMENTATION_GEOMETRY_TRIANGLE_INTERSECTIONS_HPP
+#define MATHLIB_IMPLEMENTATION_GEOMETRY_TRIANGLE_INTERSECTIONS_HPP
+
+// Note(3011):
+// Ray triangle tests that solve distance and barycentric coordinates in one
+// go. U and V are the weights of B and C, the hit point is
+// A + U * (B - A) + V * (C - A). Edges count as inside, so a ray through an
+// edge shared by two triangles hits at least one of them. Rays in the plane
+// of the triangle and degenerate triangles miss.
+
+#include "Shapes.hpp"
+
+#include <type_traits>
+
+namespace Math::Geometry
+{
+    template <Concept::StrongFloatType T>
+    struct TriangleIntersection : public Intersection<T>
+    {
+    public:
+        using ScalarType = T;
+
+        [[nodiscard]] constexpr
+        TriangleIntersection(ScalarType distance = ScalarType::NaN(), ScalarType u = Cast<T>(0), ScalarType v = Cast<T>(0)) noexcept
+            : Intersection<T>(distance), U(u), V(v)
+        {}
+
+        ScalarType U;
+        ScalarType V;
+    };
+
+    // Note(3011): Edges and normal of a triangle, computed once for meshes
+    // that do not move. The normal is not normalized.
+    template <Concept::StrongFloatType T>
+    struct PrecomputedTriangle
+    {
+    public:
+        using ScalarType = T;
+        using PointType = Point<T>;
+        using VectorType = Vector3T<T>;
+
+        [[nodiscard]] constexpr explicit
+        PrecomputedTriangle(const Triangle<T>& triangle) noexcept
+            : A(triangle.A), EdgeB(triangle.B - triangle.A), EdgeC(triangle.C - triangle.A), Normal(Cross(EdgeB, EdgeC))
+        {}
+
+        [[nodiscard]] constexpr
+        VectorType SurfaceNormal([[maybe_unused]] const PointType& surfacePoint) const noexcept
+        {
+            return Normal;
+        }
+
+        PointType A;
+        VectorType EdgeB;
+        VectorType EdgeC;
+        VectorType Normal;
+    };
+
+    // Note(3011): Möller and Trumbore, Cramer's rule on
+    // O + t * D = A + u * (B - A) + v * (C - A).
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    TriangleIntersection<T> MollerTrumboreIntersection(const Ray<T>& ray, const Interval<T>& interval, const Triangle<T>& triangle) noexcept
+    {
+        using VectorType = Vector3T<T>;
+
+        VectorType edgeB = triangle.B - triangle.A;
+        VectorType edgeC = triangle.C - triangle.A;
+        VectorType p = Cross(ray.Direction, edgeC);
+        T det = Dot(edgeB, p);
+        if (det == Cast<T>(0))
+        {
+            return {};
+        }
+
+        T inverseDet = Cast<T>(1) / det;
+        VectorType s = ray.Origin - triangle.A;
+        T u = Dot(s, p) * inverseDet;
+        if (u < Cast<T>(0) || u > Cast<T>(1))
+        {
+            return {};
+        }
+
+        VectorType q = Cross(s, edgeB);
+        T v = Dot(ray.Direction, q) * inverseDet;
+        if (v < Cast<T>(0) || u + v > Cast<T>(1))
+        {
+            return {};
+        }
+
+        return TriangleIntersection<T>(interval.Pick(Dot(edgeC, q) * inverseDet), u, v);
+    }
+
+    // Note(3011): Same system as above, rearranged around the cached normal,
+    // so it takes one cross product instead of two.
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    TriangleIntersection<T> NearestIntersection(const Ray<T>& ray, const Interval<T>& interval, const PrecomputedTriangle<T>& triangle) noexcept
+    {
+        using VectorType = Vector3T<T>;
+
+        T det = Dot(ray.Direction, triangle.Normal);
+        if (det == Cast<T>(0))
+        {
+            return {};
+        }
+
+        T inverseDet = Cast<T>(1) / det;
+        VectorType s = ray.Origin - triangle.A;
+        VectorType q = Cross(ray.Direction, s);
+        T u = Dot(triangle.EdgeC, q) * inverseDet;
+        T v = -Dot(triangle.EdgeB, q) * inverseDet;
+        if (u < Cast<T>(0) || v < Cast<T>(0) || u + v > Cast<T>(1))
+        {
+            return {};
+        }
+
+        return TriangleIntersection<T>(interval.Pick(-Dot(s, triangle.Normal) * inverseDet), u, v);
+    }
+}
+
+namespace Math::Geometry::Implementation
+{
+    // Note(3011): The 2D edge functions of the watertight test. Values that
+    // come out exactly zero are redone in double precision for floats,
+    // otherwise rounding could let a ray slip between two triangles.
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    T EdgeFunction(T ax, T ay, T bx, T by) noexcept
+    {
+        T value = ax * by - ay * bx;
+        if constexpr (std::is_same_v<T, f32>)
+        {
+            if (value == Cast<T>(0))
+            {
+                value = Cast<T>(Cast<f64>(ax) * Cast<f64>(by) - Cast<f64>(ay) * Cast<f64>(bx));
+            }
+        }
+        return value;
+    }
+}
+
+namespace Math::Geometry
+{
+    // Note(3011): Woop, Benthin and Wald, "Watertight Ray/Triangle
+    // Intersection". The vertices are moved into a space where the ray runs
+    // along +z from the origin, then the hit is decided by the signs of three
+    // 2D edge functions. Neighbouring triangles compute the same value for
+    // their shared edge, so no ray falls through the gap.
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    TriangleIntersection<T> WatertightIntersection(const Ray<T>& ray, const Interval<T>& interval, const Triangle<T>& triangle) noexcept
+    {
+        using VectorType = Vector3T<T>;
+
+        VectorType absDirection(Abs(ray.Direction.x), Abs(ray.Direction.y), Abs(ray.Direction.z));
+        SizeType kz = absDirection.x > absDirection.y ? (absDirection.x > absDirection.z ? 0 : 2) : (absDirection.y > absDirection.z ? 1 : 2);
+        SizeType kx = (kz + 1) % 3;
+        SizeType ky = (kx + 1) % 3;
+        if (ray.Direction[kz] < Cast<T>(0))
+        {
+            SizeType swap = kx;
+            kx = ky;
+            ky = swap;
+        }
+
+        T directionZ = ray.Direction[kz];
+        if (directionZ == Cast<T>(0))
+        {
+            return {};
+        }
+
+        T shearX = ray.Direction[kx] / directionZ;
+        T shearY = ray.Direction[ky] / directionZ;
+        T shearZ = Cast<T>(1) / directionZ;
+
+        VectorType a = triangle.A - ray.Origin;
+        VectorType b = triangle.B - ray.Origin;
+        VectorType c = triangle.C - ray.Origin;
+
+        T ax = a[kx] - shearX * a[kz];
+        T ay = a[ky] - shearY * a[kz];
+        T bx = b[kx] - shearX * b[kz];
+        T by = b[ky] - shearY * b[kz];
+        T cx = c[kx] - shearX * c[kz];
+        T cy = c[ky] - shearY * c[kz];
+
+        T wa = Implementation::EdgeFunction(cx, cy, bx, by);
+        T wb = Implementation::EdgeFunction(ax, ay, cx, cy);
+        T wc = Implementation::EdgeFunction(bx, by, ax, ay);
+
+        bool anyNegative = wa < Cast<T>(0) || wb < Cast<T>(0) || wc < Cast<T>(0);
+        bool anyPositive = wa > Cast<T>(0) || wb > Cast<T>(0) || wc > Cast<T>(0);
+        if (anyNegative && anyPositive)
+        {
+            return {};
+        }
+
+        T det = wa + wb + wc;
+        if (det == Cast<T>(0))
+        {
+            return {};
+        }
+
+        T scaled = wa * (shearZ * a[kz]) + wb * (shearZ * b[kz]) + wc * (shearZ * c[kz]);
+        T inverseDet = Cast<T>(1) / det;
+        return TriangleIntersection<T>(interval.Pick(scaled * inverseDet), wb * inverseDet, wc * inverseDet);
+    }
+}
+
+#endif //MATHLIB_IMPLEMENTATION_GEOMETRY_TRIANGLE_INTERSECTIONS_HPP
@@ -0,0 +1,321 @@
+#ifndef MATHLIB_IMPLEMENTATION_GEOMETRY_TRIANGLE_MESH_HPP
+#define MATHLIB_IMPLEMENTATION_GEOMETRY_TRIANGLE_MESH_HPP
+
+// Note(3011):
+// Indexed triangle mesh. Vertices are shared between the triangles that use
+// them, and everything is stored component by component in contiguous
+// arrays. Next to the vertices, every triangle keeps the data of a
+// PrecomputedTriangle, so intersection loops read it in order instead of
+// gathering vertices through the indices. The mesh is immutable once built.
+
+#include "../Base/Array.hpp"
+#include "BVH.hpp"
+#include "Components.hpp"
+#include "TriangleIntersections.hpp"
+
+#include <span>
+#include <vector>
+
+namespace Math::Geometry
+{
+    template <Concept::StrongFloatType T>
+    class TriangleMesh final
+    {
+    public:
+        using ScalarType = T;
+        using PointType = Point<T>;
+        using VectorType = Vector3T<T>;
+
+        struct Hit : public TriangleIntersection<T>
+        {
+            SizeType Index = 0;
+        };
+
+        // Note(3011): Number of triangles the full mesh loops intersect at
+        // once, without branching, before picking the nearest of them.
+        static constexpr SizeType Lanes = 8;
+
+        [[nodiscard]]
+        TriangleMesh() noexcept = default;
+
+        // Note(3011): Every three indices make a triangle, a trailing
+        // incomplete one is dropped. Indices must be below vertices.size().
+        [[nodiscard]]
+        TriangleMesh(std::span<const PointType> vertices, std::span<const u32> indices)
+        {
+            mVertices.Resize(SizeType(vertices.size()));
+            for (SizeType i = 0; i < SizeType(vertices.size()); ++i)
+            {
+                mVertices.Set(i, vertices[ToUnderlying(i)]);
+            }
+
+            // Note(3011): The triangle data is padded to whole batches. The
+            // padding is all zeros, a degenerate triangle every ray misses.
+            SizeType count = SizeType(indices.size()) / SizeType(3);
+            SizeType padded = (count + Lanes - SizeType(1)) / Lanes * Lanes;
+            mIndices.assign(indices.begin(), indices.begin() + ToUnderlying(count * SizeType(3)));
+            mA.Resize(padded);
+            mEdgeB.Resize(padded);
+            mEdgeC.Resize(padded);
+            mNormals.Resize(padded);
+            for (SizeType i = 0; i < count; ++i)
+            {
+                PrecomputedTriangle<T> triangle(GetTriangle(i));
+                mA.Set(i, triangle.A);
+                mEdgeB.Set(i, triangle.EdgeB);
+                mEdgeC.Set(i, triangle.EdgeC);
+                mNormals.Set(i, triangle.Normal);
+            }
+        }
+
+        [[nodiscard]]
+        SizeType VertexCount() const noexcept
+        {
+            return SizeType(mVertices.X.size());
+        }
+
+        [[nodiscard]]
+        SizeType TriangleCount() const noexcept
+        {
+            return SizeType(mIndices.size()) / SizeType(3);
+        }
+
+        [[nodiscard]]
+        std::span<const u32> Indices() const noexcept
+        {
+            return mIndices;
+        }
+
+        [[nodiscard]]
+        PointType Vertex(SizeType index) const noexcept
+        {
+            return mVertices.template Get<PointType>(index);
+        }
+
+        [[nodiscard]]
+        Triangle<T> GetTriangle(SizeType index) const noexcept
+        {
+            SizeType first = index * SizeType(3);
+            return Triangle<T>(
+                Vertex(Cast<SizeType>(mIndices[ToUnderlying(first)])),
+                Vertex(Cast<SizeType>(mIndices[ToUnderlying(first + SizeType(1))])),
+                Vertex(Cast<SizeType>(mIndices[ToUnderlying(first + SizeType(2))]))
+            );
+        }
+
+        // Note(3011): Not normalized, like Triangle::SurfaceNormal.
+        [[nodiscard]]
+        VectorType Normal(SizeType index) const noexcept
+        {
+            return mNormals.template Get<VectorType>(index);
+        }
+
+        // Note(3011): Bounds of the vertices, also the ones no triangle uses.
+        [[nodiscard]]
+        Box<T> Bounds() const noexcept
+        {
+            Implementation::GrowingBox<T> bounds;
+            for (SizeType i = 0; i < VertexCount(); ++i)
+            {
+                bounds.Grow(Vertex(i));
+            }
+            return VertexCount() > SizeType(0) ? Box<T>(bounds.Min, bounds.Max) : Box<T>(PointType(Cast<T>(0)), PointType(Cast<T>(0)));
+        }
+
+        // Note(3011): One box per triangle, in order, as a BVH takes them.
+        [[nodiscard]]
+        std::vector<Box<T>> TriangleBounds() const
+        {
+            std::vector<Box<T>> bounds;
+            bounds.reserve(ToUnderlying(TriangleCount()));
+            for (SizeType i = 0; i < TriangleCount(); ++i)
+            {
+                bounds.push_back(BoundingBox(GetTriangle(i)));
+            }
+            return bounds;
+        }
+
+        // Note(3011): Same result as NearestIntersection with the
+        // PrecomputedTriangle of the triangle.
+        [[nodiscard]]
+        TriangleIntersection<T> NearestIntersection(const Ray<T>& ray, const Interval<T>& interval, SizeType index) const noexcept
+        {
+            T u;
+            T v;
+            T distance = Intersect(ray, interval, index, u, v);
+            return TriangleIntersection<T>(distance, u, v);
+        }
+
+        [[nodiscard]]
+        Hit NearestIntersection(const Ray<T>& ray, const Interval<T>& interval) const noexcept
+        {
+            Hit nearest;
+            ForEachBatch(ray, interval, [&](SizeType base, const Array<T, Lanes>& distances, const Array<T, Lanes>& us, const Array<T, Lanes>& vs)
+            {
+                for (SizeType lane = 0; lane < Lanes; ++lane)
+                {
+                    if (distances[lane] < nearest.Distance || (!nearest.IsValid() && distances[lane] == distances[lane]))
+                    {
+                        nearest.Distance = distances[lane];
+                        nearest.U = us[lane];
+                        nearest.V = vs[lane];
+                        nearest.Index = base + lane;
+                    }
+                }
+                return false;
+            });
+            return nearest;
+        }
+
+        [[nodiscard]]
+        bool HasIntersection(const Ray<T>& ray, const Interval<T>& interval) const noexcept
+        {
+            return ForEachBatch(ray, interval, [&](SizeType, const Array<T, Lanes>& distances, const Array<T, Lanes>&, const Array<T, Lanes>&)
+            {
+                bool any = false;
+                for (SizeType lane = 0; lane < Lanes; ++lane)
+                {
+                    any |= distances[lane] == distances[lane];
+                }
+                return any;
+            });
+        }
+
+        // Note(3011): The nearest hit among some of the triangles, like the
+        // ones of a BVH leaf.
+        [[nodiscard]]
+        Hit NearestIntersection(const Ray<T>& ray, const Interval<T>& interval, std::span<const u32> triangles) const noexcept
+        {
+            Hit nearest;
+            Interval<T> current = interval;
+            for (u32 index : triangles)
+            {
+                TriangleIntersection<T> hit = NearestIntersection(ray, current, Cast<SizeType>(index));
+                if (hit)
+                {
+                    current.Max = hit.Distance;
+                    nearest.Distance = hit.Distance;
+                    nearest.U = hit.U;
+                    nearest.V = hit.V;
+                    nearest.Index = Cast<SizeType>(index);
+                }
+            }
+            return nearest;
+        }
+
+        [[nodiscard]]
+        bool HasIntersection(const Ray<T>& ray, const Interval<T>& interval, std::span<const u32> triangles) const noexcept
+        {
+            for (u32 index : triangles)
+            {
+                if (NearestIntersection(ray, interval, Cast<SizeType>(index)))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+    private:
+        // Note(3011): The PrecomputedTriangle test without branches, NaN if
+        // the triangle is missed. Written out on the components, in the
+        // order Dot and Cross use, so the results are the same and batches
+        // of it stay in registers.
+        [[nodiscard]]
+        T Intersect(const Ray<T>& ray, const Interval<T>& interval, SizeType index, T& u, T& v) const noexcept
+        {
+            auto i = ToUnderlying(index);
+            T dx = ray.Direction.x;
+            T dy = ray.Direction.y;
+            T dz = ray.Direction.z;
+            T nx = mNormals.X[i];
+            T ny = mNormals.Y[i];
+            T nz = mNormals.Z[i];
+
+            T sx = ray.Origin.x - mA.X[i];
+            T sy = ray.Origin.y - mA.Y[i];
+            T sz = ray.Origin.z - mA.Z[i];
+            T qx = dy * sz - dz * sy;
+            T qy = dz * sx - dx * sz;
+            T qz = dx * sy - dy * sx;
+
+            T det = dx * nx + dy * ny + dz * nz;
+            T inverseDet = Cast<T>(1) / det;
+            u = (mEdgeC.X[i] * qx + mEdgeC.Y[i] * qy + mEdgeC.Z[i] * qz) * inverseDet;
+            v = -(mEdgeB.X[i] * qx + mEdgeB.Y[i] * qy + mEdgeB.Z[i] * qz) * inverseDet;
+            T distance = -(sx * nx + sy * ny + sz * nz) * inverseDet;
+
+            bool inside = det != Cast<T>(0) && u >= Cast<T>(0) && v >= Cast<T>(0) && u + v <= Cast<T>(1);
+            bool inInterval = interval.Min <= distance && distance <= interval.Max;
+            return (inside && inInterval) ? distance : T::NaN();
+        }
+
+        // Note(3011): Intersects the triangles Lanes at a time and hands the
+        // results to visit(base, distances, us, vs). Stops when visit
+        // returns true.
+        template <typename Visitor>
+        bool ForEachBatch(const Ray<T>& ray, const Interval<T>& interval, Visitor&& visit) const noexcept
+        {
+            SizeType count = SizeType(mA.X.size());
+            for (SizeType base = 0; base < count; base += Lanes)
+            {
+                Array<T, Lanes> distances;
+                Array<T, Lanes> us;
+                Array<T, Lanes> vs;
+                for (SizeType lane = 0; lane < Lanes; ++lane)
+                {
+                    distances[lane] = Intersect(ray, interval, base + lane, us[lane], vs[lane]);
+                }
+
+                if (visit(base, distances, us, vs))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        Implementation::Components<T> mVertices;
+        std::vector<u32> mIndices;
+
+        Implementation::Components<T> mA;
+        Implementation::Components<T> mEdgeB;
+        Implementation::Components<T> mEdgeC;
+        Implementation::Components<T> mNormals;
+    };
+
+    // Note(3011): The BVH only asks for hits nearer than the nearest one so
+    // far, so the barycentrics of the last valid candidate are the ones of
+    // the hit.
+    template <Concept::StrongFloatType T>
+    [[nodiscard]]
+    typename TriangleMesh<T>::Hit NearestIntersection(const Ray<T>& ray, const Interval<T>& interval, const BVH<T>& bvh, const TriangleMesh<T>& mesh)
+    {
+        typename TriangleMesh<T>::Hit nearest;
+        typename BVH<T>::Hit hit = bvh.NearestIntersection(ray, interval, [&](SizeType index, const Ray<T>& r, const Interval<T>& i)
+        {
+            TriangleIntersection<T> candidate = mesh.NearestIntersection(r, i, index);
+            if (candidate.IsValid())
+            {
+                nearest.U = candidate.U;
+                nearest.V = candidate.V;
+            }
+            return Intersection<T>(candidate);
+        });
+
+        nearest.Distance = hit.Distance;
+        nearest.Index = hit.Index;
+        return nearest;
+    }
+
+    template <Concept::StrongFloatType T>
+    [[nodiscard]]
+    bool HasIntersection(const Ray<T>& ray, const Interval<T>& interval, const BVH<T>& bvh, const TriangleMesh<T>& mesh)
+    {
+        return bvh.HasIntersection(ray, interval, [&](SizeType index, const Ray<T>& r, const Interval<T>& i)
+        {
+            return mesh.NearestIntersection(r, i, index).IsValid();
+        });
+    }
+}
+
+#endif //MATHLIB_IMPLEMENTATION_GEOMETRY_TRIANGLE_MESH_HPP
@@ -0,0 +1,222 @@
+#ifndef MATHLIB_IMPLEMENTATION_NOISE_BAKE_HPP
+#define MATHLIB_IMPLEMENTATION_NOISE_BAKE_HPP
+
+// Note(3011):
+// Samples a noise on a regular 2D or 3D grid, spread over several threads.
+// The grid is split into tiles of whole rows, which the threads take one
+// after the other until none are left. Every row goes through the grid
+// evaluation of the noise where it has one, which reuses the lattice work
+// along the scanline, otherwise through its batch evaluation or point by
+// point. The row starts at x = 0 and its y and z come from the row index
+// only, so every sample is computed from its own grid coordinates and the
+// output does not depend on the number of threads or on which thread baked
+// which tile. The noises are only ever called through const member
+// functions, sharing them between threads is safe.
+
+#include "../Base/Array.hpp"
+#include "../../Functions.hpp"
+#include "../../Vector.hpp"
+
+#include <atomic>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Math::Noise::Implementation
+{
+    // Note(3011): A tile holds at least 4096 samples, 16 KiB of f32 values,
+    // and always at least one row.
+    inline constexpr SizeType sBakeTileSamples = 4096;
+
+    template <SizeType Dimensions, typename Noise, typename Float>
+    class Baker final
+    {
+    public:
+        using Point = ConditionalType<Dimensions == 2, Vector2T<Float>, Vector3T<Float>>;
+        using Dims = ConditionalType<Dimensions == 2, Vector2T<SizeType>, Vector3T<SizeType>>;
+
+        // Note(3011): The rows of the grid are numbered with y changing
+        // fastest, a tile covers mTileRows consecutive rows of that.
+        [[nodiscard]]
+        Baker(const Noise& noise, const Point& origin, const Point& step, const Array<SizeType, 3>& dims, Float* values) noexcept
+            : mNoise(noise), mOrigin(origin), mStep(step), mDims(dims), mValues(values)
+        {
+            mRows = dims[1] * dims[2];
+            mTileRows = Max(sBakeTileSamples / dims[0], SizeType(1));
+            mTileCount = (mRows + mTileRows - 1) / mTileRows;
+        }
+
+        [[nodiscard]]
+        SizeType TileCount() const noexcept
+        {
+            return mTileCount;
+        }
+
+        void BakeTile(SizeType tile) const noexcept
+        {
+            SizeType beginRow = tile * mTileRows;
+            SizeType endRow = Min(beginRow + mTileRows, mRows);
+            for (SizeType row = beginRow; row < endRow; ++row)
+            {
+                BakeRow(row % mDims[1], row / mDims[1], mValues + ToUnderlying(row * mDims[0]));
+            }
+        }
+
+    private:
+        void BakeRow(SizeType y, SizeType z, Float* out) const noexcept
+        {
+            SizeType width = mDims[0];
+            if constexpr (requires { mNoise.FillGrid(Point(), Point(), Dims(), std::span<Float>()); })
+            {
+                Dims dims;
+                if constexpr (Dimensions == 2)
+                {
+                    dims = Dims(width, SizeType(1));
+                }
+                else
+                {
+                    dims = Dims(width, SizeType(1), SizeType(1));
+                }
+                mNoise.FillGrid(MakePoint(0, y, z), mStep, dims, std::span<Float>(out, ToUnderlying(width)));
+            }
+            else
+            {
+                Array<Point, 64> points;
+                for (SizeType begin = 0; begin < width; begin += points.Size)
+                {
+                    SizeType count = Min(points.Size, width - begin);
+                    for (SizeType i = 0; i < count; ++i)
+                    {
+                        points[i] = MakePoint(begin + i, y, z);
+                    }
+
+                    if constexpr (requires { mNoise.Evaluate(std::span<const Point>(), std::span<Float>()); })
+                    {
+                        mNoise.Evaluate(std::span<const Point>(points.Data(), ToUnderlying(count)), std::span<Float>(out + ToUnderlying(begin), ToUnderlying(count)));
+                    }
+                    else
+                    {
+                        for (SizeType i = 0; i < count; ++i)
+                        {
+                            out[ToUnderlying(begin + i)] = mNoise(points[i]);
+                        }
+                    }
+                }
+            }
+        }
+
+        [[nodiscard]]
+        Point MakePoint(SizeType x, SizeType y, SizeType z) const noexcept
+        {
+            if constexpr (Dimensions == 2)
+            {
+                return Point(mOrigin.x + mStep.x * Cast<Float>(x), mOrigin.y + mStep.y * Cast<Float>(y));
+            }
+            else
+            {
+                return Point(mOrigin.x + mStep.x * Cast<Float>(x), mOrigin.y + mStep.y * Cast<Float>(y), mOrigin.z + mStep.z * Cast<Float>(z));
+            }
+        }
+
+        const Noise& mNoise;
+        Point mOrigin;
+        Point mStep;
+        Array<SizeType, 3> mDims;
+        Float* mValues;
+        SizeType mRows;
+        SizeType mTileRows;
+        SizeType mTileCount;
+    };
+
+    // Note(3011): Joins the workers when leaving Bake, also when starting
+    // one of them threw. Destroying a joinable std::thread would terminate
+    // the program.
+    class ThreadJoiner final
+    {
+    public:
+        [[nodiscard]] explicit
+        ThreadJoiner(std::vector<std::thread>& threads) noexcept
+            : mThreads(threads)
+        {}
+
+        ThreadJoiner(const ThreadJoiner&) = delete;
+        ThreadJoiner& operator=(const ThreadJoiner&) = delete;
+
+        ~ThreadJoiner()
+        {
+            for (std::thread& thread : mThreads)
+            {
+                if (thread.joinable())
+                {
+                    thread.join();
+                }
+            }
+        }
+    private:
+        std::vector<std::thread>& mThreads;
+    };
+
+    template <SizeType Dimensions, typename Noise, typename Float>
+    void Bake(const Baker<Dimensions, Noise, Float>& baker, SizeType threads)
+    {
+        SizeType workers = ToUnderlying(threads) ? threads : Max(SizeType(std::thread::hardware_concurrency()), SizeType(1));
+        workers = Min(workers, baker.TileCount());
+
+        std::atomic<UnderlyingType<SizeType>> next = 0;
+        auto work = [&baker, &next]()
+        {
+            for (SizeType tile = next.fetch_add(1); tile < baker.TileCount(); tile = next.fetch_add(1))
+            {
+                baker.BakeTile(tile);
+            }
+        };
+
+        // Note(3011): The calling thread is one of the workers.
+        std::vector<std::thread> pool;
+        ThreadJoiner joiner(pool);
+        pool.reserve(ToUnderlying(workers));
+        for (SizeType i = 1; i < workers; ++i)
+        {
+            pool.emplace_back(work);
+        }
+        work();
+    }
+}
+
+namespace Math::Noise
+{
+    // Note(3011): Sample (x, y) is taken at origin + extent * (x, y) / resolution
+    // and written to values[y * resolution.x + x], values has to hold all
+    // resolution.x * resolution.y samples or nothing is written. With 0
+    // threads, one thread per hardware thread is used.
+    template <typename Noise, Concept::FloatingPointType Float>
+    void Bake(const Noise& noise, const Vector2T<Float>& origin, const Vector2T<Float>& extent, const Vector2T<SizeType>& resolution,
+              std::type_identity_t<std::span<Float>> values, SizeType threads = 0)
+    {
+        if (SizeType(values.size()) < resolution.x * resolution.y || !ToUnderlying(resolution.x * resolution.y))
+        {
+            return;
+        }
+
+        Vector2T<Float> step(extent.x / Cast<Float>(resolution.x), extent.y / Cast<Float>(resolution.y));
+        Implementation::Baker<2, Noise, Float> baker(noise, origin, step, Array<SizeType, 3>(resolution.x, resolution.y, SizeType(1)), values.data());
+        Implementation::Bake(baker, threads);
+    }
+
+    template <typename Noise, Concept::FloatingPointType Float>
+    void Bake(const Noise& noise, const Vector3T<Float>& origin, const Vector3T<Float>& extent, const Vector3T<SizeType>& resolution,
+              std::type_identity_t<std::span<Float>> values, SizeType threads = 0)
+    {
+        if (SizeType(values.size()) < resolution.x * resolution.y * resolution.z || !ToUnderlying(resolution.x * resolution.y * resolution.z))
+        {
+            return;
+        }
+
+        Vector3T<Float> step(extent.x / Cast<Float>(resolution.x), extent.y / Cast<Float>(resolution.y), extent.z / Cast<Float>(resolution.z));
+        Implementation::Baker<3, Noise, Float> baker(noise, origin, step, Array<SizeType, 3>(resolution.x, resolution.y, resolution.z), values.data());
+        Implementation::Bake(baker, threads);
+    }
+}
+
+#endif //MATHLIB_IMPLEMENTATION_NOISE_BAKE_HPP
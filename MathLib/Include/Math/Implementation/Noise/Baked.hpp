@@ -0,0 +1,199 @@
+#ifndef MATHLIB_IMPLEMENTATION_NOISE_BAKED_HPP
+#define MATHLIB_IMPLEMENTATION_NOISE_BAKED_HPP
+
+// Note(3011):
+// A noise sampled once on a regular grid, looked up with linear filtering
+// afterwards. A lookup reads 4 (2D) or 8 (3D) neighboring samples from one
+// contiguous buffer, instead of hashing and interpolating lattice corners.
+// The grid covers a single tile from origin to origin + extent, which repeats
+// outside of it. Baking a periodic noise over a whole number of periods gives
+// a seamless tile.
+
+#include "../Base/Array.hpp"
+#include "../../Functions.hpp"
+#include "../../Vector.hpp"
+#include "Bake.hpp"
+
+#include <cstddef>
+#include <new>
+#include <span>
+#include <vector>
+
+namespace Math::Noise::Implementation
+{
+    // Note(3011): Cache line aligned storage, so a row of samples never
+    // starts in the middle of a line.
+    template <typename T>
+    class AlignedAllocator
+    {
+    public:
+        using value_type = T;
+
+        static constexpr std::size_t Alignment = 64;
+
+        AlignedAllocator() noexcept = default;
+
+        template <typename U>
+        constexpr
+        AlignedAllocator(const AlignedAllocator<U>&) noexcept
+        {}
+
+        [[nodiscard]]
+        T* allocate(std::size_t count)
+        {
+            return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(Alignment)));
+        }
+
+        void deallocate(T* pointer, std::size_t count) noexcept
+        {
+            ::operator delete(pointer, count * sizeof(T), std::align_val_t(Alignment));
+        }
+
+        template <typename U>
+        [[nodiscard]] friend constexpr
+        bool operator==(const AlignedAllocator&, const AlignedAllocator<U>&) noexcept
+        {
+            return true;
+        }
+    };
+}
+
+namespace Math::Noise
+{
+    template <Concept::FloatingPointType Float, SizeType Dimensions>
+        requires (Dimensions == 2 || Dimensions == 3)
+    class BakedNoise final
+    {
+    public:
+        using ValueType = Float;
+        using PointType = ConditionalType<Dimensions == 2, Vector2T<Float>, Vector3T<Float>>;
+        using SizeVector = ConditionalType<Dimensions == 2, Vector2T<SizeType>, Vector3T<SizeType>>;
+
+        // Note(3011): Sample i along an axis is taken at
+        // origin + extent * i / resolution, see Bake. The sample at
+        // i = resolution would be the first one of the next tile, so the
+        // tile wraps around without a seam if the noise repeats every extent.
+        // Resolutions are at least 1.
+        template <typename Noise>
+        [[nodiscard]] explicit
+        BakedNoise(const Noise& noise, const PointType& origin, const PointType& extent, const SizeVector& resolution, SizeType threads = 1)
+        {
+            SizeVector dims;
+            SizeType count = 1;
+            for (SizeType axis = 0; axis < Dimensions; ++axis)
+            {
+                dims[axis] = Max(resolution[axis], SizeType(1));
+                count *= dims[axis];
+
+                mOrigin[axis] = origin[axis];
+                mScale[axis] = Cast<Float>(dims[axis]) / extent[axis];
+                mResolution[axis] = Cast<Int>(dims[axis]);
+                mSize[axis] = Cast<Float>(dims[axis]);
+                mInverseSize[axis] = Float(1) / mSize[axis];
+            }
+
+            mValues.resize(ToUnderlying(count));
+            Bake(noise, origin, extent, dims, std::span<Float>(mValues), threads);
+        }
+
+        [[nodiscard]]
+        SizeVector Resolution() const noexcept
+        {
+            SizeVector resolution;
+            for (SizeType axis = 0; axis < Dimensions; ++axis)
+            {
+                resolution[axis] = Cast<SizeType>(mResolution[axis]);
+            }
+            return resolution;
+        }
+
+        // Note(3011): The samples, row by row with x being the fastest
+        // changing index.
+        [[nodiscard]]
+        std::span<const Float> Values() const noexcept
+        {
+            return mValues;
+        }
+
+        [[nodiscard]]
+        Float operator()(const PointType& in) const noexcept
+        {
+            Array<Int, Dimensions> lower;
+            Array<Int, Dimensions> upper;
+            Array<Float, Dimensions> weight;
+            for (SizeType axis = 0; axis < Dimensions; ++axis)
+            {
+                Locate(in[axis], axis, lower[axis], upper[axis], weight[axis]);
+            }
+
+            if constexpr (Dimensions == 2)
+            {
+                Int row0 = lower[1] * mResolution[0];
+                Int row1 = upper[1] * mResolution[0];
+                return Lerp(weight[1], Lerp(weight[0], At(row0 + lower[0]), At(row0 + upper[0])),
+                                       Lerp(weight[0], At(row1 + lower[0]), At(row1 + upper[0])));
+            }
+            else
+            {
+                Int slice = mResolution[0] * mResolution[1];
+                Int row00 = lower[2] * slice + lower[1] * mResolution[0];
+                Int row10 = lower[2] * slice + upper[1] * mResolution[0];
+                Int row01 = upper[2] * slice + lower[1] * mResolution[0];
+                Int row11 = upper[2] * slice + upper[1] * mResolution[0];
+                return Lerp(weight[2], Lerp(weight[1], Lerp(weight[0], At(row00 + lower[0]), At(row00 + upper[0])),
+                                                       Lerp(weight[0], At(row10 + lower[0]), At(row10 + upper[0]))),
+                                       Lerp(weight[1], Lerp(weight[0], At(row01 + lower[0]), At(row01 + upper[0])),
+                                                       Lerp(weight[0], At(row11 + lower[0]), At(row11 + upper[0]))));
+            }
+        }
+
+        void Evaluate(std::span<const PointType> points, std::span<Float> values) const noexcept
+        {
+            SizeType count = Min(SizeType(points.size()), SizeType(values.size()));
+            for (SizeType i = 0; i < count; ++i)
+            {
+                values[ToUnderlying(i)] = (*this)(points[ToUnderlying(i)]);
+            }
+        }
+
+    private:
+        using Int = SignedIntegerSelector<sizeof(Float)>;
+
+        // Note(3011): Wraps the coordinate into the tile with a multiply
+        // instead of an integer modulo. Rounding can leave it just outside of
+        // the tile, the cell index is wrapped once more for that.
+        void Locate(Float value, SizeType axis, Int& lower, Int& upper, Float& weight) const noexcept
+        {
+            Float position = (value - mOrigin[axis]) * mScale[axis];
+            position -= Floor(position * mInverseSize[axis]) * mSize[axis];
+
+            Int resolution = mResolution[axis];
+            lower = Floor<Int>(position);
+            weight = position - Cast<Float>(lower);
+            if (ToUnderlying(lower) < 0)
+            {
+                lower += resolution;
+            }
+            else if (ToUnderlying(lower) >= ToUnderlying(resolution))
+            {
+                lower -= resolution;
+            }
+            upper = ToUnderlying(lower) + 1 < ToUnderlying(resolution) ? lower + Int(1) : Int(0);
+        }
+
+        [[nodiscard]]
+        Float At(Int index) const noexcept
+        {
+            return mValues[ToUnderlying(Cast<SizeType>(index))];
+        }
+
+        std::vector<Float, Implementation::AlignedAllocator<Float>> mValues;
+        Array<Float, Dimensions> mOrigin;
+        Array<Float, Dimensions> mScale;
+        Array<Float, Dimensions> mSize;
+        Array<Float, Dimensions> mInverseSize;
+        Array<Int, Dimensions> mResolution;
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_NOISE_BAKED_HPP
@@ -0,0 +1,242 @@
+#ifndef MATHLIB_IMPLEMENTATION_NOISE_LATTICE_HPP
+#define MATHLIB_IMPLEMENTATION_NOISE_LATTICE_HPP
+
+// Note(3011):
+// Building blocks shared by the gradient noises: the hashes of lattice points
+// and the gradient tables. The seeded permutation wraps lattice coordinates
+// around every 256 cells. IntegerHash mixes the coordinates arithmetically
+// instead, it needs no table and repeats only every 2^32 cells.
+//
+// Perlin takes the hash as a policy. A hash provides:
+//   CellType               the type of a lattice coordinate
+//   MaxPeriod              the largest period it can tile with
+//   Cell(Int coordinate)   maps the floor of an input coordinate to a cell
+//   Offset(cell, offset)   the cell offset (0 or 1) cells further along an axis
+//   Hash(cells...)         hashes 2 to 4 cells, at least the low 5 bits of
+//                          the result have to be well distributed
+
+#include "../Base/Array.hpp"
+#include "../../Random.hpp"
+#include "../../Vector.hpp"
+
+namespace Math::Noise
+{
+    // Note(3011): The value of a noise together with its gradient, the
+    // partial derivatives of the value along every input axis.
+    template <typename Vector>
+    struct ValueWithGradient
+    {
+        typename Vector::ScalarType Value;
+        Vector Gradient;
+    };
+}
+
+namespace Math::Noise::Implementation
+{
+    class Permutation final
+    {
+    public:
+        using CellType = u8;
+
+        static constexpr SizeType MaxPeriod = 256;
+
+        // Note(3011): Seed 0 keeps Ken Perlin's reference permutation, any
+        // other seed shuffles it.
+        [[nodiscard]] constexpr explicit
+        Permutation(u64 seed = 0) noexcept
+            : mTable(sDefaultTable)
+        {
+            if (ToUnderlying(seed))
+            {
+                Random64 rng(seed);
+                Shuffle(std::span<u8>(mTable.Data(), ToUnderlying(mTable.Size)), rng);
+            }
+        }
+
+        // Note(3011): Mirrored at 0 instead of wrapping around, as Perlin
+        // noise always did.
+        template <typename Int>
+        [[nodiscard]] static constexpr
+        u8 Cell(Int coordinate) noexcept
+        {
+            return Cast<u8>(Abs(coordinate) & 255);
+        }
+
+        [[nodiscard]] constexpr
+        u8 Hash(u8 x) const noexcept
+        {
+            return mTable[Cast<SizeType>(x)];
+        }
+
+        // Note(3011): P[... P[z + P[y + P[x]]]], the hash of the previous
+        // coordinates is added to the next one before looking it up.
+        template <typename... Rest>
+        [[nodiscard]] constexpr
+        u8 Hash(u8 x, u8 y, Rest... rest) const noexcept
+        {
+            return Hash(Offset(y, Hash(x)), rest...);
+        }
+
+        [[nodiscard]] static constexpr
+        u8 Offset(u8 cell, u8 offset) noexcept
+        {
+            return Cast<u8>((Cast<u16>(cell) + Cast<u16>(offset)) & 255);
+        }
+    private:
+        Array<u8, 256> mTable;
+
+        static constexpr Array<u8, 256> sDefaultTable = Array<u8, 256>(
+            151, 160, 137, 91,  90,  15,  131, 13,  201, 95,  96,  53,  194, 233, 7,   225,
+            140, 36,  103, 30,  69,  142, 8,   99,  37,  240, 21,  10,  23,  190, 6,   148,
+            247, 120, 234, 75,  0,   26,  197, 62,  94,  252, 219, 203, 117, 35,  11,  32,
+            57,  177, 33,  88,  237, 149, 56,  87,  174, 20,  125, 136, 171, 168, 68,  175,
+            74,  165, 71,  134, 139, 48,  27,  166, 77,  146, 158, 231, 83,  111, 229, 122,
+            60,  211, 133, 230, 220, 105, 92,  41,  55,  46,  245, 40,  244, 102, 143, 54,
+            65,  25,  63,  161, 1,   216, 80,  73,  209, 76, 132,  187, 208, 89,  18,  169,
+            200, 196, 135, 130, 116, 188, 159, 86,  164, 100, 109, 198, 173, 186, 3,   64,
+            52,  217, 226, 250, 124, 123, 5,   202, 38,  147, 118, 126, 255, 82,  85,  212,
+            207, 206, 59,  227, 47,  16,  58,  17,  182, 189, 28,  42,  223, 183, 170, 213,
+            119, 248, 152, 2,   44,  154, 163, 70,  221, 153, 101, 155, 167, 43,  172, 9,
+            129, 22,  39,  253, 19,  98,  108, 110, 79,  113, 224, 232, 178, 185, 112, 104,
+            218, 246, 97,  228, 251, 34,  242, 193, 238, 210, 144, 12,  191, 179, 162, 241,
+            81,  51,  145, 235, 249, 14,  239, 107, 49,  192, 214, 31,  181, 199, 106, 157,
+            184, 84,  204, 176, 115, 121, 50,  45,  127, 4,   150, 254, 138, 236, 205, 93,
+            222, 114, 67,  29,  24,  72,  243, 141, 128, 195, 78,  66,  215, 61,  156, 180
+        );
+    };
+
+    // Note(3011): Maps a signed lattice coordinate onto the 256 cells of the
+    // permutation. Negative coordinates wrap around like two's complement.
+    template <typename Int>
+    [[nodiscard]] constexpr
+    u8 LatticeIndex(Int coordinate) noexcept
+    {
+        return Cast<u8>(ToUnderlying(coordinate) & 255);
+    }
+
+    // Note(3011): The gradients are looked up from tables instead of being
+    // selected with branches. These are the gradient sets of Ken Perlin's
+    // reference implementation, indexed by the low bits of a hash.
+    inline constexpr Array<i8, 8> sGradient2X = Array<i8, 8>(1, -1, 1, -1, 2, 2, -2, -2);
+    inline constexpr Array<i8, 8> sGradient2Y = Array<i8, 8>(2, 2, -2, -2, 1, -1, 1, -1);
+
+    inline constexpr Array<i8, 16> sGradient3X = Array<i8, 16>(1, -1, 1, -1, 1, -1, 1, -1, 0, 0, 0, 0, 1, 0, -1, 0);
+    inline constexpr Array<i8, 16> sGradient3Y = Array<i8, 16>(1, 1, -1, -1, 0, 0, 0, 0, 1, -1, 1, -1, 1, -1, 1, -1);
+    inline constexpr Array<i8, 16> sGradient3Z = Array<i8, 16>(0, 0, 0, 0, 1, 1, -1, -1, 1, 1, -1, -1, 0, 1, 0, -1);
+
+    inline constexpr Array<i8, 32> sGradient4X = Array<i8, 32>(
+         1, -1,  1, -1,  1, -1,  1, -1,  1, -1,  1, -1,  1, -1,  1, -1,
+         1, -1,  1, -1,  1, -1,  1, -1,  0,  0,  0,  0,  0,  0,  0,  0
+    );
+    inline constexpr Array<i8, 32> sGradient4Y = Array<i8, 32>(
+         1,  1, -1, -1,  1,  1, -1, -1,  1,  1, -1, -1,  1,  1, -1, -1,
+         0,  0,  0,  0,  0,  0,  0,  0,  1, -1,  1, -1,  1, -1,  1, -1
+    );
+    inline constexpr Array<i8, 32> sGradient4Z = Array<i8, 32>(
+         1,  1,  1,  1, -1, -1, -1, -1,  0,  0,  0,  0,  0,  0,  0,  0,
+         1,  1, -1, -1,  1,  1, -1, -1,  1,  1, -1, -1,  1,  1, -1, -1
+    );
+    inline constexpr Array<i8, 32> sGradient4W = Array<i8, 32>(
+         0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1, -1, -1, -1, -1,
+         1,  1,  1,  1, -1, -1, -1, -1,  1,  1,  1,  1, -1, -1, -1, -1
+    );
+
+    template <Concept::FloatingPointType Float>
+    [[nodiscard]] constexpr
+    Float Grad(u8 hash, Float x, Float y) noexcept
+    {
+        SizeType index = Cast<SizeType>(hash & 7);
+        return Cast<Float>(sGradient2X[index]) * x + Cast<Float>(sGradient2Y[index]) * y;
+    }
+
+    template <Concept::FloatingPointType Float>
+    [[nodiscard]] constexpr
+    Float Grad(u8 hash, Float x, Float y, Float z) noexcept
+    {
+        SizeType index = Cast<SizeType>(hash & 15);
+        return Cast<Float>(sGradient3X[index]) * x + Cast<Float>(sGradient3Y[index]) * y + Cast<Float>(sGradient3Z[index]) * z;
+    }
+
+    template <Concept::FloatingPointType Float>
+    [[nodiscard]] constexpr
+    Float Grad(u8 hash, Float x, Float y, Float z, Float w) noexcept
+    {
+        SizeType index = Cast<SizeType>(hash & 31);
+        return Cast<Float>(sGradient4X[index]) * x + Cast<Float>(sGradient4Y[index]) * y
+             + Cast<Float>(sGradient4Z[index]) * z + Cast<Float>(sGradient4W[index]) * w;
+    }
+}
+
+namespace Math::Noise
+{
+    // Note(3011): The permutation table of Ken Perlin's reference
+    // implementation, four dependent lookups for a 4D corner.
+    using PermutationHash = Implementation::Permutation;
+
+    // Note(3011): Adds the coordinates, each multiplied by its own odd
+    // constant, to the seed, mixes the sum with one xorshift and multiply
+    // and keeps the top 8 bits, the best mixed ones. Only multiplies, xors
+    // and shifts, no memory accesses, and no table to store per instance.
+    // The outputs are different from the ones of the permutation table.
+    class IntegerHash final
+    {
+    public:
+        using CellType = u32;
+
+        static constexpr SizeType MaxPeriod = SizeType(1) << 24;
+
+        [[nodiscard]] constexpr explicit
+        IntegerHash(u64 seed = 0) noexcept
+            : mSeed(Cast<u32>(seed ^ (seed >> u64(32))))
+        {}
+
+        // Note(3011): Two's complement, so the lattice continues across 0.
+        template <typename Int>
+        [[nodiscard]] static constexpr
+        u32 Cell(Int coordinate) noexcept
+        {
+            return Cast<u32>(Cast<i64>(coordinate));
+        }
+
+        [[nodiscard]] static constexpr
+        u32 Offset(u32 cell, u8 offset) noexcept
+        {
+            return cell + Cast<u32>(offset);
+        }
+
+        [[nodiscard]] constexpr
+        u8 Hash(u32 x, u32 y) const noexcept
+        {
+            return Finalize(mSeed + x * sPrimeX + y * sPrimeY);
+        }
+
+        [[nodiscard]] constexpr
+        u8 Hash(u32 x, u32 y, u32 z) const noexcept
+        {
+            return Finalize(mSeed + x * sPrimeX + y * sPrimeY + z * sPrimeZ);
+        }
+
+        [[nodiscard]] constexpr
+        u8 Hash(u32 x, u32 y, u32 z, u32 w) const noexcept
+        {
+            return Finalize(mSeed + x * sPrimeX + y * sPrimeY + z * sPrimeZ + w * sPrimeW);
+        }
+    private:
+        [[nodiscard]] static constexpr
+        u8 Finalize(u32 hash) noexcept
+        {
+            hash ^= hash >> u32(15);
+            hash *= u32(0x2C1B3C6D);
+            return Cast<u8>(hash >> u32(24));
+        }
+
+        static constexpr u32 sPrimeX = 0x8DA6B343;
+        static constexpr u32 sPrimeY = 0xD8163841;
+        static constexpr u32 sPrimeZ = 0xCB1AB31F;
+        static constexpr u32 sPrimeW = 0x9E3779B1;
+
+        u32 mSeed;
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_NOISE_LATTICE_HPP
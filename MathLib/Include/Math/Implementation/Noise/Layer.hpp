@@ -1,41 +1,349 @@
 #ifndef MATHLIB_IMPLEMENTATION_NOISE_LAYER_HPP
 #define MATHLIB_IMPLEMENTATION_NOISE_LAYER_HPP
 
+// Note(3011):
+// Fractal sums of a base noise. Every octave samples the base noise at
+// Lacunarity times the frequency and Gain times the amplitude of the previous
+// one. The base noises return values in [0, 1], which are shaped per octave:
+//   FBm:    the signed noise, 2v - 1.
+//   Billow: its absolute value, giving puffy, rounded shapes.
+//   Ridged: the square of the inverted absolute value, (1 - |2v - 1|)^2,
+//           which turns the zero crossings into sharp ridges.
+// The sum is normalized by the sum of the amplitudes, so the result is in
+// [0, 1] as well. Every octave has its own seed, derived from the layer seed,
+// so the octaves do not line up at the origin.
+//
+// The octaves are copies of a prototype base noise, reseeded with
+// Reseeded(seed), so they keep its other settings: the period and hash of
+// Perlin noise or the feature and metric of Worley noise. A periodic Perlin
+// layer only tiles when Lacunarity is an integer.
+
 #include "../Base/Array.hpp"
+#include "../../Functions.hpp"
 #include "../../Vector.hpp"
 
+#include <span>
+
 namespace Math::Noise
 {
-    template <Concept::FloatingPointType Float, template <typename> typename BaseNoise>
+    enum class FractalMode
+    {
+        FBm,
+        Billow,
+        Ridged
+    };
+
+    template <Concept::FloatingPointType Float>
+    struct LayerParameters
+    {
+        SizeType Octaves = 4;
+        Float Lacunarity = Float(2);
+        Float Gain = Float(0.5);
+        FractalMode Mode = FractalMode::FBm;
+    };
+
+    template <Concept::FloatingPointType Float, template <typename...> typename BaseNoise>
     class Layer final
     {
     public:
         using ValueType = Float;
+        using BaseType = BaseNoise<Float>;
+
+        static constexpr SizeType MaxOctaves = 16;
 
+        // Note(3011): Octaves of the default constructed base noise.
         [[nodiscard]] constexpr explicit
-        Layer(u64 seed = 0) noexcept
-            : mBaseNoise(seed)
+        Layer(u64 seed = 0, const LayerParameters<Float>& parameters = {}) noexcept
+            : Layer(BaseType(), seed, parameters)
         {}
 
+        // Note(3011): The octave count is clamped to [1, MaxOctaves]. The
+        // first octave uses the layer seed itself, so a single octave layer
+        // is the same as the prototype reseeded with it.
+        [[nodiscard]] constexpr
+        Layer(const BaseType& prototype, u64 seed, const LayerParameters<Float>& parameters = {}) noexcept
+            : mOctaves(Clamp(parameters.Octaves, SizeType(1), MaxOctaves)), mMode(parameters.Mode)
+        {
+            Float frequency = Float(1);
+            Float amplitude = Float(1);
+            Float amplitudeSum = Float(0);
+            for (SizeType octave = 0; octave < mOctaves; ++octave)
+            {
+                mNoises[ToUnderlying(octave)] = prototype.Reseeded(seed + Cast<u64>(octave) * u64(0x9E3779B97F4A7C15));
+                mFrequencies[octave] = frequency;
+                mAmplitudes[octave] = amplitude;
+                amplitudeSum += amplitude;
+                frequency *= parameters.Lacunarity;
+                amplitude *= parameters.Gain;
+            }
+            mNormalization = Float(1) / amplitudeSum;
+        }
+
+        [[nodiscard]] constexpr
+        SizeType Octaves() const noexcept
+        {
+            return mOctaves;
+        }
+
+        [[nodiscard]] constexpr
+        FractalMode Mode() const noexcept
+        {
+            return mMode;
+        }
+
         [[nodiscard]] constexpr
         Float operator()(const Vector2T<Float>& in) const noexcept
         {
-            return Float(0);
+            return EvaluateOne(in);
         }
 
         [[nodiscard]] constexpr
         Float operator()(const Vector3T<Float>& in) const noexcept
         {
-            return Float(0);
+            return EvaluateOne(in);
         }
 
         [[nodiscard]] constexpr
         Float operator()(const Vector4T<Float>& in) const noexcept
         {
-            return Float(0);
+            return EvaluateOne(in);
         }
+
+        // Note(3011): The batch versions produce exactly the same values as
+        // evaluating every point on its own. Instead of summing all octaves
+        // of one point before moving on to the next, every octave is run over
+        // a whole block of BlockSize points, using the batch evaluation of
+        // the base noise where it has one. The block and its sums stay in
+        // the cache, and the per octave loops can be vectorized.
+        static constexpr SizeType BlockSize = 64;
+
+        constexpr
+        void Evaluate(std::span<const Vector2T<Float>> points, std::span<Float> values) const noexcept
+        {
+            EvaluateBlocks(points, values);
+        }
+
+        constexpr
+        void Evaluate(std::span<const Vector3T<Float>> points, std::span<Float> values) const noexcept
+        {
+            EvaluateBlocks(points, values);
+        }
+
+        constexpr
+        void Evaluate(std::span<const Vector4T<Float>> points, std::span<Float> values) const noexcept
+        {
+            EvaluateBlocks(points, values);
+        }
+
+        // Note(3011): Samples origin + step * (x, y) for all x < dims.x and
+        // y < dims.y, row by row with x being the fastest changing index.
+        // values has to hold all samples of the grid or nothing is written.
+        constexpr
+        void FillGrid(const Vector2T<Float>& origin, const Vector2T<Float>& step, const Vector2T<SizeType>& dims, std::span<Float> values) const noexcept
+        {
+            if (SizeType(values.size()) < dims.x * dims.y)
+            {
+                return;
+            }
+
+            Float* out = values.data();
+            for (SizeType y = 0; y < dims.y; ++y)
+            {
+                Float py = origin.y + step.y * Cast<Float>(y);
+                for (SizeType begin = 0; begin < dims.x; begin += BlockSize)
+                {
+                    SizeType count = Min(BlockSize, dims.x - begin);
+                    Array<Vector2T<Float>, BlockSize> points;
+                    for (SizeType i = 0; i < count; ++i)
+                    {
+                        points[i] = Vector2T<Float>(origin.x + step.x * Cast<Float>(begin + i), py);
+                    }
+                    EvaluateBlock(points, count, out);
+                    out += ToUnderlying(count);
+                }
+            }
+        }
+
+        constexpr
+        void FillGrid(const Vector3T<Float>& origin, const Vector3T<Float>& step, const Vector3T<SizeType>& dims, std::span<Float> values) const noexcept
+        {
+            if (SizeType(values.size()) < dims.x * dims.y * dims.z)
+            {
+                return;
+            }
+
+            Float* out = values.data();
+            for (SizeType z = 0; z < dims.z; ++z)
+            {
+                Float pz = origin.z + step.z * Cast<Float>(z);
+                for (SizeType y = 0; y < dims.y; ++y)
+                {
+                    Float py = origin.y + step.y * Cast<Float>(y);
+                    for (SizeType begin = 0; begin < dims.x; begin += BlockSize)
+                    {
+                        SizeType count = Min(BlockSize, dims.x - begin);
+                        Array<Vector3T<Float>, BlockSize> points;
+                        for (SizeType i = 0; i < count; ++i)
+                        {
+                            points[i] = Vector3T<Float>(origin.x + step.x * Cast<Float>(begin + i), py, pz);
+                        }
+                        EvaluateBlock(points, count, out);
+                        out += ToUnderlying(count);
+                    }
+                }
+            }
+        }
+
     private:
-        BaseNoise<Float> mBaseNoise;
+        template <FractalMode Mode>
+        [[nodiscard]] static constexpr
+        Float Shape(Float value) noexcept
+        {
+            Float signedValue = value * Float(2) - Float(1);
+            if constexpr (Mode == FractalMode::FBm)
+            {
+                return signedValue;
+            }
+            else
+            {
+                Float magnitude = Abs(signedValue);
+                if constexpr (Mode == FractalMode::Billow)
+                {
+                    return magnitude;
+                }
+                else
+                {
+                    Float ridge = Float(1) - magnitude;
+                    return ridge * ridge;
+                }
+            }
+        }
+
+        template <FractalMode Mode>
+        [[nodiscard]] constexpr
+        Float Finish(Float sum) const noexcept
+        {
+            if constexpr (Mode == FractalMode::FBm)
+            {
+                return (sum * mNormalization + Float(1)) / Float(2);
+            }
+            else
+            {
+                return sum * mNormalization;
+            }
+        }
+
+        template <typename Point>
+        [[nodiscard]] constexpr
+        Float EvaluateOne(const Point& in) const noexcept
+        {
+            switch (mMode)
+            {
+            case FractalMode::Billow:
+                return EvaluateOne<FractalMode::Billow>(in);
+            case FractalMode::Ridged:
+                return EvaluateOne<FractalMode::Ridged>(in);
+            default:
+                return EvaluateOne<FractalMode::FBm>(in);
+            }
+        }
+
+        template <FractalMode Mode, typename Point>
+        [[nodiscard]] constexpr
+        Float EvaluateOne(const Point& in) const noexcept
+        {
+            Float sum = Float(0);
+            for (SizeType octave = 0; octave < mOctaves; ++octave)
+            {
+                sum += mAmplitudes[octave] * Shape<Mode>(mNoises[ToUnderlying(octave)](in * mFrequencies[octave]));
+            }
+            return Finish<Mode>(sum);
+        }
+
+        template <typename Point>
+        constexpr
+        void EvaluateBlocks(std::span<const Point> points, std::span<Float> values) const noexcept
+        {
+            SizeType count = Min(SizeType(points.size()), SizeType(values.size()));
+            for (SizeType begin = 0; begin < count; begin += BlockSize)
+            {
+                SizeType blockCount = Min(BlockSize, count - begin);
+                Array<Point, BlockSize> block;
+                for (SizeType i = 0; i < blockCount; ++i)
+                {
+                    block[i] = points[ToUnderlying(begin + i)];
+                }
+                EvaluateBlock(block, blockCount, values.data() + ToUnderlying(begin));
+            }
+        }
+
+        template <typename Point>
+        constexpr
+        void EvaluateBlock(const Array<Point, BlockSize>& points, SizeType count, Float* out) const noexcept
+        {
+            switch (mMode)
+            {
+            case FractalMode::Billow:
+                EvaluateBlock<FractalMode::Billow>(points, count, out);
+                break;
+            case FractalMode::Ridged:
+                EvaluateBlock<FractalMode::Ridged>(points, count, out);
+                break;
+            default:
+                EvaluateBlock<FractalMode::FBm>(points, count, out);
+                break;
+            }
+        }
+
+        template <FractalMode Mode, typename Point>
+        constexpr
+        void EvaluateBlock(const Array<Point, BlockSize>& points, SizeType count, Float* out) const noexcept
+        {
+            Array<Float, BlockSize> sum;
+            Array<Float, BlockSize> octaveValues;
+            Array<Point, BlockSize> scaled;
+            for (SizeType octave = 0; octave < mOctaves; ++octave)
+            {
+                Float frequency = mFrequencies[octave];
+                for (SizeType i = 0; i < count; ++i)
+                {
+                    scaled[i] = points[i] * frequency;
+                }
+
+                const BaseType& noise = mNoises[ToUnderlying(octave)];
+                if constexpr (requires { noise.Evaluate(std::span<const Point>(), std::span<Float>()); })
+                {
+                    noise.Evaluate(std::span<const Point>(scaled.Data(), ToUnderlying(count)), std::span<Float>(octaveValues.Data(), ToUnderlying(count)));
+                }
+                else
+                {
+                    for (SizeType i = 0; i < count; ++i)
+                    {
+                        octaveValues[i] = noise(scaled[i]);
+                    }
+                }
+
+                Float amplitude = mAmplitudes[octave];
+                for (SizeType i = 0; i < count; ++i)
+                {
+                    sum[i] += amplitude * Shape<Mode>(octaveValues[i]);
+                }
+            }
+
+            for (SizeType i = 0; i < count; ++i)
+            {
+                out[ToUnderlying(i)] = Finish<Mode>(sum[i]);
+            }
+        }
+
+        // Note(3011): Not an Array, its value initialization would go through
+        // the explicit constructors of the noises.
+        BaseType mNoises[ToUnderlying(MaxOctaves)];
+        Array<Float, MaxOctaves> mFrequencies;
+        Array<Float, MaxOctaves> mAmplitudes;
+        Float mNormalization;
+        SizeType mOctaves;
+        FractalMode mMode;
     };
 }
 
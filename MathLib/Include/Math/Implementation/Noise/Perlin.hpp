@@ -3,76 +3,273 @@
 
 #include "../Base/Array.hpp"
 #include "../../Functions.hpp"
-#include "../../Random.hpp"
 #include "../../Vector.hpp"
+#include "Lattice.hpp"
+
+#include <span>
 
 namespace Math::Noise
 {
-    template <Concept::FloatingPointType Float>
+    // Note(3011): Hasher hashes the lattice points, see Lattice.hpp. The
+    // default permutation table keeps the outputs of the reference
+    // implementation, IntegerHash trades them for a hash without table
+    // lookups and without the 256 cell period.
+    template <Concept::FloatingPointType Float, typename Hasher = PermutationHash>
     class Perlin final
     {
     public:
         using ValueType = Float;
 
+        static constexpr SizeType MaxPeriod = Hasher::MaxPeriod;
+
+        // Note(3011): With a period of 0 the lattice is the one of the hash,
+        // for the permutation table that is mirrored at 0 and repeating
+        // every 256 cells. Any other period, clamped to MaxPeriod, makes the
+        // noise tile: the value at p and p + period along any axis is the
+        // same, for negative coordinates as well.
         [[nodiscard]] constexpr explicit
-        Perlin(u64 seed = 0) noexcept
-            : mPermutation(sDefaultPermutation)
+        Perlin(u64 seed = 0, SizeType period = 0) noexcept
+            : mHasher(seed), mPeriod(Min(period, MaxPeriod))
+        {}
+
+        [[nodiscard]] constexpr
+        SizeType Period() const noexcept
         {
-            if (ToUnderlying(seed))
-            {
-                Random64 rng(seed);
-                mPermutation.Shuffle<Random64, UniformDistribution>(rng);
-            }
+            return mPeriod;
+        }
+
+        // Note(3011): Keeps the period and the hash policy, only the seed
+        // changes.
+        [[nodiscard]] constexpr
+        Perlin Reseeded(u64 seed) const noexcept
+        {
+            return Perlin(seed, mPeriod);
         }
 
         [[nodiscard]] constexpr
         Float operator()(const Vector2T<Float>& in) const noexcept
         {
-            using Int = SignedIntegerSelector<sizeof(Float)>;
+            return ToUnderlying(mPeriod) ? Sample<true>(in) : Sample<false>(in);
+        }
+
+        [[nodiscard]] constexpr
+        Float operator()(const Vector3T<Float>& in) const noexcept
+        {
+            return ToUnderlying(mPeriod) ? Sample<true>(in) : Sample<false>(in);
+        }
+
+        [[nodiscard]] constexpr
+        Float operator()(const Vector4T<Float>& in) const noexcept
+        {
+            return ToUnderlying(mPeriod) ? Sample<true>(in) : Sample<false>(in);
+        }
 
-            u8 xi = Cast<u8>(Abs(Floor<Int>(in.x)) & 255);
-            u8 yi = Cast<u8>(Abs(Floor<Int>(in.y)) & 255);
+        // Note(3011): The value, exactly as returned by operator(), and its
+        // analytic gradient. Both are interpolated from the same hashed
+        // corners, the gradient uses the derivative of the fade curve.
+        [[nodiscard]] constexpr
+        ValueWithGradient<Vector2T<Float>> EvaluateWithGradient(const Vector2T<Float>& in) const noexcept
+        {
+            Array<Float, 2> point(in.x, in.y);
+            Interpolant<2> result = ToUnderlying(mPeriod) ? InterpolateWithGradient<true, 2>(point) : InterpolateWithGradient<false, 2>(point);
+            return { (result.Value + 2) / 4, Vector2T<Float>(result.Gradient[0], result.Gradient[1]) / Float(4) };
+        }
 
-            Float xf = Frac(in.x);
-            Float yf = Frac(in.y);
+        [[nodiscard]] constexpr
+        ValueWithGradient<Vector3T<Float>> EvaluateWithGradient(const Vector3T<Float>& in) const noexcept
+        {
+            Array<Float, 3> point(in.x, in.y, in.z);
+            Interpolant<3> result = ToUnderlying(mPeriod) ? InterpolateWithGradient<true, 3>(point) : InterpolateWithGradient<false, 3>(point);
+            return { (result.Value + 1) / 2, Vector3T<Float>(result.Gradient[0], result.Gradient[1], result.Gradient[2]) / Float(2) };
+        }
+
+        [[nodiscard]] constexpr
+        ValueWithGradient<Vector4T<Float>> EvaluateWithGradient(const Vector4T<Float>& in) const noexcept
+        {
+            Array<Float, 4> point(in.x, in.y, in.z, in.w);
+            Interpolant<4> result = ToUnderlying(mPeriod) ? InterpolateWithGradient<true, 4>(point) : InterpolateWithGradient<false, 4>(point);
+            return { (result.Value + 1) / 2, Vector4T<Float>(result.Gradient[0], result.Gradient[1], result.Gradient[2], result.Gradient[3]) / Float(2) };
+        }
+
+        // Note(3011): The batch versions produce exactly the same values as
+        // evaluating every point on its own. Points are processed in blocks of
+        // BatchSize lanes: the lattice hashes (table lookups) are gathered
+        // first, then the gradients and interpolation run over the whole block
+        // without branches, so the compiler can vectorize that part.
+        static constexpr SizeType BatchSize = 8;
+
+        constexpr
+        void Evaluate(std::span<const Vector2T<Float>> points, std::span<Float> values) const noexcept
+        {
+            if (ToUnderlying(mPeriod))
+            {
+                EvaluateBatch<true>(points, values);
+            }
+            else
+            {
+                EvaluateBatch<false>(points, values);
+            }
+        }
+
+        constexpr
+        void Evaluate(std::span<const Vector3T<Float>> points, std::span<Float> values) const noexcept
+        {
+            if (ToUnderlying(mPeriod))
+            {
+                EvaluateBatch<true>(points, values);
+            }
+            else
+            {
+                EvaluateBatch<false>(points, values);
+            }
+        }
+
+        // Note(3011): Samples origin + step * (x, y) for all x < dims.x and
+        // y < dims.y, row by row with x being the fastest changing index. The
+        // corner gradients of a lattice cell are only looked up once per
+        // scanline, no matter how many samples fall into it. values has to
+        // hold all samples of the grid or nothing is written.
+        constexpr
+        void FillGrid(const Vector2T<Float>& origin, const Vector2T<Float>& step, const Vector2T<SizeType>& dims, std::span<Float> values) const noexcept
+        {
+            if (SizeType(values.size()) < dims.x * dims.y)
+            {
+                return;
+            }
+
+            if (ToUnderlying(mPeriod))
+            {
+                FillGridRows<true>(origin, step, dims, values);
+            }
+            else
+            {
+                FillGridRows<false>(origin, step, dims, values);
+            }
+        }
+
+        constexpr
+        void FillGrid(const Vector3T<Float>& origin, const Vector3T<Float>& step, const Vector3T<SizeType>& dims, std::span<Float> values) const noexcept
+        {
+            if (SizeType(values.size()) < dims.x * dims.y * dims.z)
+            {
+                return;
+            }
+
+            if (ToUnderlying(mPeriod))
+            {
+                FillGridRows<true>(origin, step, dims, values);
+            }
+            else
+            {
+                FillGridRows<false>(origin, step, dims, values);
+            }
+        }
+
+    private:
+        using Cell = typename Hasher::CellType;
+
+        // Note(3011): Gradients of the corners of a lattice cell, in the
+        // order (0, 0), (1, 0), (0, 1), (1, 1) (x changing fastest).
+        struct Corners2
+        {
+            Array<Float, 4> X;
+            Array<Float, 4> Y;
+        };
+
+        struct Corners3
+        {
+            Array<Float, 8> X;
+            Array<Float, 8> Y;
+            Array<Float, 8> Z;
+        };
+
+        struct Block2
+        {
+            constexpr
+            void Store(const Corners2& corners, SizeType lane) noexcept
+            {
+                for (SizeType corner = 0; corner < 4; ++corner)
+                {
+                    GX[corner][lane] = corners.X[corner];
+                    GY[corner][lane] = corners.Y[corner];
+                }
+            }
+
+            Array<Float, BatchSize> X;
+            Array<Float, BatchSize> Y;
+            Array<Array<Float, BatchSize>, 4> GX;
+            Array<Array<Float, BatchSize>, 4> GY;
+        };
+
+        struct Block3
+        {
+            constexpr
+            void Store(const Corners3& corners, SizeType lane) noexcept
+            {
+                for (SizeType corner = 0; corner < 8; ++corner)
+                {
+                    GX[corner][lane] = corners.X[corner];
+                    GY[corner][lane] = corners.Y[corner];
+                    GZ[corner][lane] = corners.Z[corner];
+                }
+            }
+
+            Array<Float, BatchSize> X;
+            Array<Float, BatchSize> Y;
+            Array<Float, BatchSize> Z;
+            Array<Array<Float, BatchSize>, 8> GX;
+            Array<Array<Float, BatchSize>, 8> GY;
+            Array<Array<Float, BatchSize>, 8> GZ;
+        };
+
+        // Note(3011): The periodic and non-periodic versions are separate
+        // instantiations, so the mode is only checked once per call.
+        template <bool Periodic>
+        [[nodiscard]] constexpr
+        Float Sample(const Vector2T<Float>& in) const noexcept
+        {
+            Cell xi = CellIndex<Periodic>(in.x);
+            Cell yi = CellIndex<Periodic>(in.y);
+
+            Float xf = LocalCoordinate<Periodic>(in.x);
+            Float yf = LocalCoordinate<Periodic>(in.y);
 
             Float u = Smootherstep(xf, Float(0), Float(1));
             Float v = Smootherstep(yf, Float(0), Float(1));
 
-            Float v1 = Grad(Hash2(xi, yi, 0, 0), xf,     yf    );
-            Float v2 = Grad(Hash2(xi, yi, 1, 0), xf - 1, yf    );
-            Float v3 = Grad(Hash2(xi, yi, 0, 1), xf,     yf - 1);
-            Float v4 = Grad(Hash2(xi, yi, 1, 1), xf - 1, yf - 1);
+            Float v1 = Grad(Hash2<Periodic>(xi, yi, 0, 0), xf,     yf    );
+            Float v2 = Grad(Hash2<Periodic>(xi, yi, 1, 0), xf - 1, yf    );
+            Float v3 = Grad(Hash2<Periodic>(xi, yi, 0, 1), xf,     yf - 1);
+            Float v4 = Grad(Hash2<Periodic>(xi, yi, 1, 1), xf - 1, yf - 1);
 
             return (Lerp(v, Lerp(u, v1, v2),
                             Lerp(u, v3, v4)) + 2) / 4;
         }
 
+        template <bool Periodic>
         [[nodiscard]] constexpr
-        Float operator()(const Vector3T<Float>& in) const noexcept
+        Float Sample(const Vector3T<Float>& in) const noexcept
         {
-            using Int = SignedIntegerSelector<sizeof(Float)>;
+            Cell xi = CellIndex<Periodic>(in.x);
+            Cell yi = CellIndex<Periodic>(in.y);
+            Cell zi = CellIndex<Periodic>(in.z);
 
-            u8 xi = Cast<u8>(Abs(Floor<Int>(in.x)) & 255);
-            u8 yi = Cast<u8>(Abs(Floor<Int>(in.y)) & 255);
-            u8 zi = Cast<u8>(Abs(Floor<Int>(in.z)) & 255);
-
-            Float xf = Frac(in.x);
-            Float yf = Frac(in.y);
-            Float zf = Frac(in.z);
+            Float xf = LocalCoordinate<Periodic>(in.x);
+            Float yf = LocalCoordinate<Periodic>(in.y);
+            Float zf = LocalCoordinate<Periodic>(in.z);
 
             Float u = Smootherstep(xf, Float(0), Float(1));
             Float v = Smootherstep(yf, Float(0), Float(1));
             Float w = Smootherstep(zf, Float(0), Float(1));
 
-            Float v1 = Grad(Hash3(xi, yi, zi, 0, 0, 0), xf,     yf,     zf    );
-            Float v2 = Grad(Hash3(xi, yi, zi, 1, 0, 0), xf - 1, yf,     zf    );
-            Float v3 = Grad(Hash3(xi, yi, zi, 0, 1, 0), xf,     yf - 1, zf    );
-            Float v4 = Grad(Hash3(xi, yi, zi, 1, 1, 0), xf - 1, yf - 1, zf    );
-            Float v5 = Grad(Hash3(xi, yi, zi, 0, 0, 1), xf,     yf,     zf - 1);
-            Float v6 = Grad(Hash3(xi, yi, zi, 1, 0, 1), xf - 1, yf,     zf - 1);
-            Float v7 = Grad(Hash3(xi, yi, zi, 0, 1, 1), xf,     yf - 1, zf - 1);
-            Float v8 = Grad(Hash3(xi, yi, zi, 1, 1, 1), xf - 1, yf - 1, zf - 1);
+            Float v1 = Grad(Hash3<Periodic>(xi, yi, zi, 0, 0, 0), xf,     yf,     zf    );
+            Float v2 = Grad(Hash3<Periodic>(xi, yi, zi, 1, 0, 0), xf - 1, yf,     zf    );
+            Float v3 = Grad(Hash3<Periodic>(xi, yi, zi, 0, 1, 0), xf,     yf - 1, zf    );
+            Float v4 = Grad(Hash3<Periodic>(xi, yi, zi, 1, 1, 0), xf - 1, yf - 1, zf    );
+            Float v5 = Grad(Hash3<Periodic>(xi, yi, zi, 0, 0, 1), xf,     yf,     zf - 1);
+            Float v6 = Grad(Hash3<Periodic>(xi, yi, zi, 1, 0, 1), xf - 1, yf,     zf - 1);
+            Float v7 = Grad(Hash3<Periodic>(xi, yi, zi, 0, 1, 1), xf,     yf - 1, zf - 1);
+            Float v8 = Grad(Hash3<Periodic>(xi, yi, zi, 1, 1, 1), xf - 1, yf - 1, zf - 1);
 
             return (Lerp(w, Lerp(v, Lerp(u, v1, v2),
                                     Lerp(u, v3, v4)),
@@ -80,42 +277,41 @@ namespace Math::Noise
                                     Lerp(u, v7, v8))) + 1) / 2;
         }
 
+        template <bool Periodic>
         [[nodiscard]] constexpr
-        Float operator()(const Vector4T<Float>& in) const noexcept
+        Float Sample(const Vector4T<Float>& in) const noexcept
         {
-            using Int = SignedIntegerSelector<sizeof(Float)>;
-
-            u8 xi = Cast<u8>(Abs(Floor<Int>(in.x)) & 255);
-            u8 yi = Cast<u8>(Abs(Floor<Int>(in.y)) & 255);
-            u8 zi = Cast<u8>(Abs(Floor<Int>(in.z)) & 255);
-            u8 wi = Cast<u8>(Abs(Floor<Int>(in.w)) & 255);
+            Cell xi = CellIndex<Periodic>(in.x);
+            Cell yi = CellIndex<Periodic>(in.y);
+            Cell zi = CellIndex<Periodic>(in.z);
+            Cell wi = CellIndex<Periodic>(in.w);
 
-            Float xf = Frac(in.x);
-            Float yf = Frac(in.y);
-            Float zf = Frac(in.z);
-            Float wf = Frac(in.w);
+            Float xf = LocalCoordinate<Periodic>(in.x);
+            Float yf = LocalCoordinate<Periodic>(in.y);
+            Float zf = LocalCoordinate<Periodic>(in.z);
+            Float wf = LocalCoordinate<Periodic>(in.w);
 
             Float u = Smootherstep(xf, Float(0), Float(1));
             Float v = Smootherstep(yf, Float(0), Float(1));
             Float s = Smootherstep(zf, Float(0), Float(1));
             Float t = Smootherstep(wf, Float(0), Float(1));
 
-            Float v1  = Grad(Hash4(xi, yi, zi, wi, 0, 0, 0, 0), xf,     yf,     zf,     wf    );
-            Float v2  = Grad(Hash4(xi, yi, zi, wi, 1, 0, 0, 0), xf - 1, yf,     zf,     wf    );
-            Float v3  = Grad(Hash4(xi, yi, zi, wi, 0, 1, 0, 0), xf,     yf - 1, zf,     wf    );
-            Float v4  = Grad(Hash4(xi, yi, zi, wi, 1, 1, 0, 0), xf - 1, yf - 1, zf,     wf    );
-            Float v5  = Grad(Hash4(xi, yi, zi, wi, 0, 0, 1, 0), xf,     yf,     zf - 1, wf    );
-            Float v6  = Grad(Hash4(xi, yi, zi, wi, 1, 0, 1, 0), xf - 1, yf,     zf - 1, wf    );
-            Float v7  = Grad(Hash4(xi, yi, zi, wi, 0, 1, 1, 0), xf,     yf - 1, zf - 1, wf    );
-            Float v8  = Grad(Hash4(xi, yi, zi, wi, 1, 1, 1, 0), xf - 1, yf - 1, zf - 1, wf    );
-            Float v9  = Grad(Hash4(xi, yi, zi, wi, 0, 0, 0, 1), xf,     yf,     zf,     wf - 1);
-            Float v10 = Grad(Hash4(xi, yi, zi, wi, 1, 0, 0, 1), xf - 1, yf,     zf,     wf - 1);
-            Float v11 = Grad(Hash4(xi, yi, zi, wi, 0, 1, 0, 1), xf,     yf - 1, zf,     wf - 1);
-            Float v12 = Grad(Hash4(xi, yi, zi, wi, 1, 1, 0, 1), xf - 1, yf - 1, zf,     wf - 1);
-            Float v13 = Grad(Hash4(xi, yi, zi, wi, 0, 0, 1, 1), xf,     yf,     zf - 1, wf - 1);
-            Float v14 = Grad(Hash4(xi, yi, zi, wi, 1, 0, 1, 1), xf - 1, yf,     zf - 1, wf - 1);
-            Float v15 = Grad(Hash4(xi, yi, zi, wi, 0, 1, 1, 1), xf,     yf - 1, zf - 1, wf - 1);
-            Float v16 = Grad(Hash4(xi, yi, zi, wi, 1, 1, 1, 1), xf - 1, yf - 1, zf - 1, wf - 1);
+            Float v1  = Grad(Hash4<Periodic>(xi, yi, zi, wi, 0, 0, 0, 0), xf,     yf,     zf,     wf    );
+            Float v2  = Grad(Hash4<Periodic>(xi, yi, zi, wi, 1, 0, 0, 0), xf - 1, yf,     zf,     wf    );
+            Float v3  = Grad(Hash4<Periodic>(xi, yi, zi, wi, 0, 1, 0, 0), xf,     yf - 1, zf,     wf    );
+            Float v4  = Grad(Hash4<Periodic>(xi, yi, zi, wi, 1, 1, 0, 0), xf - 1, yf - 1, zf,     wf    );
+            Float v5  = Grad(Hash4<Periodic>(xi, yi, zi, wi, 0, 0, 1, 0), xf,     yf,     zf - 1, wf    );
+            Float v6  = Grad(Hash4<Periodic>(xi, yi, zi, wi, 1, 0, 1, 0), xf - 1, yf,     zf - 1, wf    );
+            Float v7  = Grad(Hash4<Periodic>(xi, yi, zi, wi, 0, 1, 1, 0), xf,     yf - 1, zf - 1, wf    );
+            Float v8  = Grad(Hash4<Periodic>(xi, yi, zi, wi, 1, 1, 1, 0), xf - 1, yf - 1, zf - 1, wf    );
+            Float v9  = Grad(Hash4<Periodic>(xi, yi, zi, wi, 0, 0, 0, 1), xf,     yf,     zf,     wf - 1);
+            Float v10 = Grad(Hash4<Periodic>(xi, yi, zi, wi, 1, 0, 0, 1), xf - 1, yf,     zf,     wf - 1);
+            Float v11 = Grad(Hash4<Periodic>(xi, yi, zi, wi, 0, 1, 0, 1), xf,     yf - 1, zf,     wf - 1);
+            Float v12 = Grad(Hash4<Periodic>(xi, yi, zi, wi, 1, 1, 0, 1), xf - 1, yf - 1, zf,     wf - 1);
+            Float v13 = Grad(Hash4<Periodic>(xi, yi, zi, wi, 0, 0, 1, 1), xf,     yf,     zf - 1, wf - 1);
+            Float v14 = Grad(Hash4<Periodic>(xi, yi, zi, wi, 1, 0, 1, 1), xf - 1, yf,     zf - 1, wf - 1);
+            Float v15 = Grad(Hash4<Periodic>(xi, yi, zi, wi, 0, 1, 1, 1), xf,     yf - 1, zf - 1, wf - 1);
+            Float v16 = Grad(Hash4<Periodic>(xi, yi, zi, wi, 1, 1, 1, 1), xf - 1, yf - 1, zf - 1, wf - 1);
 
             return (Lerp(t, Lerp(s, Lerp(v, Lerp(u,  v1,  v2),
                                             Lerp(u,  v3,  v4)),
@@ -127,89 +323,468 @@ namespace Math::Noise
                                             Lerp(u, v15, v16)))) + 1) / 2;
         }
 
-    private:
+        template <bool Periodic>
+        constexpr
+        void EvaluateBatch(std::span<const Vector2T<Float>> points, std::span<Float> values) const noexcept
+        {
+            SizeType count = Min(SizeType(points.size()), SizeType(values.size()));
+            for (SizeType begin = 0; begin < count; begin += BatchSize)
+            {
+                SizeType lanes = Min(BatchSize, count - begin);
+                Block2 block;
+                for (SizeType lane = 0; lane < lanes; ++lane)
+                {
+                    const Vector2T<Float>& point = points[ToUnderlying(begin + lane)];
+                    block.X[lane] = LocalCoordinate<Periodic>(point.x);
+                    block.Y[lane] = LocalCoordinate<Periodic>(point.y);
+                    Corners2 corners = LoadCorners<Periodic>(CellIndex<Periodic>(point.x), CellIndex<Periodic>(point.y));
+                    block.Store(corners, lane);
+                }
+                Interpolate(block, lanes, values.data() + ToUnderlying(begin));
+            }
+        }
+
+        template <bool Periodic>
+        constexpr
+        void EvaluateBatch(std::span<const Vector3T<Float>> points, std::span<Float> values) const noexcept
+        {
+            SizeType count = Min(SizeType(points.size()), SizeType(values.size()));
+            for (SizeType begin = 0; begin < count; begin += BatchSize)
+            {
+                SizeType lanes = Min(BatchSize, count - begin);
+                Block3 block;
+                for (SizeType lane = 0; lane < lanes; ++lane)
+                {
+                    const Vector3T<Float>& point = points[ToUnderlying(begin + lane)];
+                    block.X[lane] = LocalCoordinate<Periodic>(point.x);
+                    block.Y[lane] = LocalCoordinate<Periodic>(point.y);
+                    block.Z[lane] = LocalCoordinate<Periodic>(point.z);
+                    Corners3 corners = LoadCorners<Periodic>(CellIndex<Periodic>(point.x), CellIndex<Periodic>(point.y), CellIndex<Periodic>(point.z));
+                    block.Store(corners, lane);
+                }
+                Interpolate(block, lanes, values.data() + ToUnderlying(begin));
+            }
+        }
+
+        template <bool Periodic>
+        constexpr
+        void FillGridRows(const Vector2T<Float>& origin, const Vector2T<Float>& step, const Vector2T<SizeType>& dims, std::span<Float> values) const noexcept
+        {
+            Float* out = values.data();
+            for (SizeType y = 0; y < dims.y; ++y)
+            {
+                Float py = origin.y + step.y * Cast<Float>(y);
+                Cell yi = CellIndex<Periodic>(py);
+                Float yf = LocalCoordinate<Periodic>(py);
+
+                Corners2 corners = {};
+                Cell cachedCell = 0;
+                bool cached = false;
+                for (SizeType begin = 0; begin < dims.x; begin += BatchSize)
+                {
+                    SizeType lanes = Min(BatchSize, dims.x - begin);
+                    Block2 block;
+                    for (SizeType lane = 0; lane < lanes; ++lane)
+                    {
+                        Float px = origin.x + step.x * Cast<Float>(begin + lane);
+                        Cell xi = CellIndex<Periodic>(px);
+                        if (!cached || xi != cachedCell)
+                        {
+                            corners = LoadCorners<Periodic>(xi, yi);
+                            cachedCell = xi;
+                            cached = true;
+                        }
+                        block.X[lane] = LocalCoordinate<Periodic>(px);
+                        block.Y[lane] = yf;
+                        block.Store(corners, lane);
+                    }
+                    Interpolate(block, lanes, out);
+                    out += ToUnderlying(lanes);
+                }
+            }
+        }
+
+        template <bool Periodic>
+        constexpr
+        void FillGridRows(const Vector3T<Float>& origin, const Vector3T<Float>& step, const Vector3T<SizeType>& dims, std::span<Float> values) const noexcept
+        {
+            Float* out = values.data();
+            for (SizeType z = 0; z < dims.z; ++z)
+            {
+                Float pz = origin.z + step.z * Cast<Float>(z);
+                Cell zi = CellIndex<Periodic>(pz);
+                Float zf = LocalCoordinate<Periodic>(pz);
+
+                for (SizeType y = 0; y < dims.y; ++y)
+                {
+                    Float py = origin.y + step.y * Cast<Float>(y);
+                    Cell yi = CellIndex<Periodic>(py);
+                    Float yf = LocalCoordinate<Periodic>(py);
+
+                    Corners3 corners = {};
+                    Cell cachedCell = 0;
+                    bool cached = false;
+                    for (SizeType begin = 0; begin < dims.x; begin += BatchSize)
+                    {
+                        SizeType lanes = Min(BatchSize, dims.x - begin);
+                        Block3 block;
+                        for (SizeType lane = 0; lane < lanes; ++lane)
+                        {
+                            Float px = origin.x + step.x * Cast<Float>(begin + lane);
+                            Cell xi = CellIndex<Periodic>(px);
+                            if (!cached || xi != cachedCell)
+                            {
+                                corners = LoadCorners<Periodic>(xi, yi, zi);
+                                cachedCell = xi;
+                                cached = true;
+                            }
+                            block.X[lane] = LocalCoordinate<Periodic>(px);
+                            block.Y[lane] = yf;
+                            block.Z[lane] = zf;
+                            block.Store(corners, lane);
+                        }
+                        Interpolate(block, lanes, out);
+                        out += ToUnderlying(lanes);
+                    }
+                }
+            }
+        }
+
+        template <bool Periodic>
         [[nodiscard]] constexpr
-        u8 Hash2(u8 x, u8 y, u8 i = 0, u8 j = 0) const noexcept
+        Cell CellIndex(Float value) const noexcept
+        {
+            using Int = SignedIntegerSelector<sizeof(Float)>;
+            Int cell = Floor<Int>(value);
+            if constexpr (Periodic)
+            {
+                Int period = Cast<Int>(mPeriod);
+                Int wrapped = cell % period;
+                return Cast<Cell>(ToUnderlying(wrapped) < 0 ? wrapped + period : wrapped);
+            }
+            else
+            {
+                return Hasher::Cell(cell);
+            }
+        }
+
+        // Note(3011): The reference implementation takes the fractional part
+        // towards 0, which does not line up with the cell for negative
+        // coordinates. The periodic version needs the offset from the lower
+        // corner of the cell, or the tiles would not match up across 0.
+        template <bool Periodic>
+        [[nodiscard]] static constexpr
+        Float LocalCoordinate(Float value) noexcept
         {
-            u16 hash = 0;
-            hash = Cast<u16>(mPermutation[Cast<SizeType>(Cast<u16>(x) + Cast<u16>(i)) & 255]);
-            hash = Cast<u16>(mPermutation[Cast<SizeType>(Cast<u16>(y) + Cast<u16>(j) + hash) & 255]);
-            return Cast<u8>(hash);
+            if constexpr (Periodic)
+            {
+                return value - Floor(value);
+            }
+            else
+            {
+                return Frac(value);
+            }
         }
 
+        // Note(3011): The neighbouring cell along an axis, which wraps around
+        // at the period.
+        template <bool Periodic>
         [[nodiscard]] constexpr
-        u8 Hash3(u8 x, u8 y, u8 z, u8 i = 0, u8 j = 0, u8 k = 0) const noexcept
+        Cell Neighbor(Cell cell, u8 offset) const noexcept
         {
-            u16 hash = 0;
-            hash = Cast<u16>(mPermutation[Cast<SizeType>(Cast<u16>(x) + Cast<u16>(i)) & 255]);
-            hash = Cast<u16>(mPermutation[Cast<SizeType>(Cast<u16>(y) + Cast<u16>(j) + hash) & 255]);
-            hash = Cast<u16>(mPermutation[Cast<SizeType>(Cast<u16>(z) + Cast<u16>(k) + hash) & 255]);
-            return Cast<u8>(hash);
+            if constexpr (Periodic)
+            {
+                SizeType next = Cast<SizeType>(cell) + Cast<SizeType>(offset);
+                return Cast<Cell>(next == mPeriod ? SizeType(0) : next);
+            }
+            else
+            {
+                return Hasher::Offset(cell, offset);
+            }
         }
 
+        template <bool Periodic>
         [[nodiscard]] constexpr
-        u8 Hash4(u8 x, u8 y, u8 z, u8 w, u8 i = 0, u8 j = 0, u8 k = 0, u8 l = 0) const noexcept
+        Corners2 LoadCorners(Cell xi, Cell yi) const noexcept
         {
-            u16 hash = 0;
-            hash = Cast<u16>(mPermutation[Cast<SizeType>(Cast<u16>(x) + Cast<u16>(i)) & 255]);
-            hash = Cast<u16>(mPermutation[Cast<SizeType>(Cast<u16>(y) + Cast<u16>(j) + hash) & 255]);
-            hash = Cast<u16>(mPermutation[Cast<SizeType>(Cast<u16>(z) + Cast<u16>(k) + hash) & 255]);
-            hash = Cast<u16>(mPermutation[Cast<SizeType>(Cast<u16>(w) + Cast<u16>(l) + hash) & 255]);
-            return Cast<u8>(hash);
+            Corners2 corners;
+            for (SizeType corner = 0; corner < 4; ++corner)
+            {
+                u8 hash = Hash2<Periodic>(xi, yi, Cast<u8>(corner & 1), Cast<u8>(corner >> 1)) & 7;
+                corners.X[corner] = Cast<Float>(Implementation::sGradient2X[Cast<SizeType>(hash)]);
+                corners.Y[corner] = Cast<Float>(Implementation::sGradient2Y[Cast<SizeType>(hash)]);
+            }
+            return corners;
         }
 
+        template <bool Periodic>
         [[nodiscard]] constexpr
-        Float Grad(u8 hash, Float x, Float y) const noexcept
+        Corners3 LoadCorners(Cell xi, Cell yi, Cell zi) const noexcept
         {
-            hash &= 7;
-            Float u = (hash < 4) ? x : y;
-            Float v = (hash < 4) ? y : x;
-            return (ToUnderlying(hash & 1) ? -u : u)
-                 + (ToUnderlying(hash & 2) ? Cast<Float>(-2) * v : Cast<Float>(2) * v);
+            Corners3 corners;
+            for (SizeType corner = 0; corner < 8; ++corner)
+            {
+                u8 hash = Hash3<Periodic>(xi, yi, zi, Cast<u8>(corner & 1), Cast<u8>((corner >> 1) & 1), Cast<u8>(corner >> 2)) & 15;
+                corners.X[corner] = Cast<Float>(Implementation::sGradient3X[Cast<SizeType>(hash)]);
+                corners.Y[corner] = Cast<Float>(Implementation::sGradient3Y[Cast<SizeType>(hash)]);
+                corners.Z[corner] = Cast<Float>(Implementation::sGradient3Z[Cast<SizeType>(hash)]);
+            }
+            return corners;
         }
 
+        static constexpr
+        void Interpolate(const Block2& block, SizeType lanes, Float* out) noexcept
+        {
+            for (SizeType lane = 0; lane < lanes; ++lane)
+            {
+                Float xf = block.X[lane];
+                Float yf = block.Y[lane];
+
+                Float u = Smootherstep(xf, Float(0), Float(1));
+                Float v = Smootherstep(yf, Float(0), Float(1));
+
+                Float v1 = block.GX[0][lane] * xf       + block.GY[0][lane] * yf;
+                Float v2 = block.GX[1][lane] * (xf - 1) + block.GY[1][lane] * yf;
+                Float v3 = block.GX[2][lane] * xf       + block.GY[2][lane] * (yf - 1);
+                Float v4 = block.GX[3][lane] * (xf - 1) + block.GY[3][lane] * (yf - 1);
+
+                out[ToUnderlying(lane)] = (Lerp(v, Lerp(u, v1, v2),
+                                                   Lerp(u, v3, v4)) + 2) / 4;
+            }
+        }
+
+        static constexpr
+        void Interpolate(const Block3& block, SizeType lanes, Float* out) noexcept
+        {
+            for (SizeType lane = 0; lane < lanes; ++lane)
+            {
+                Float xf = block.X[lane];
+                Float yf = block.Y[lane];
+                Float zf = block.Z[lane];
+
+                Float u = Smootherstep(xf, Float(0), Float(1));
+                Float v = Smootherstep(yf, Float(0), Float(1));
+                Float w = Smootherstep(zf, Float(0), Float(1));
+
+                Float x0 = xf;
+                Float x1 = xf - 1;
+                Float y0 = yf;
+                Float y1 = yf - 1;
+                Float z0 = zf;
+                Float z1 = zf - 1;
+
+                Float v1 = block.GX[0][lane] * x0 + block.GY[0][lane] * y0 + block.GZ[0][lane] * z0;
+                Float v2 = block.GX[1][lane] * x1 + block.GY[1][lane] * y0 + block.GZ[1][lane] * z0;
+                Float v3 = block.GX[2][lane] * x0 + block.GY[2][lane] * y1 + block.GZ[2][lane] * z0;
+                Float v4 = block.GX[3][lane] * x1 + block.GY[3][lane] * y1 + block.GZ[3][lane] * z0;
+                Float v5 = block.GX[4][lane] * x0 + block.GY[4][lane] * y0 + block.GZ[4][lane] * z1;
+                Float v6 = block.GX[5][lane] * x1 + block.GY[5][lane] * y0 + block.GZ[5][lane] * z1;
+                Float v7 = block.GX[6][lane] * x0 + block.GY[6][lane] * y1 + block.GZ[6][lane] * z1;
+                Float v8 = block.GX[7][lane] * x1 + block.GY[7][lane] * y1 + block.GZ[7][lane] * z1;
+
+                out[ToUnderlying(lane)] = (Lerp(w, Lerp(v, Lerp(u, v1, v2),
+                                                           Lerp(u, v3, v4)),
+                                                   Lerp(v, Lerp(u, v5, v6),
+                                                           Lerp(u, v7, v8))) + 1) / 2;
+            }
+        }
+
+        template <SizeType Dimensions>
+        struct Interpolant
+        {
+            Float Value;
+            Array<Float, Dimensions> Gradient;
+        };
+
+        // Note(3011): Interpolates the corner values the same way operator()
+        // does. Along the difference axis, the two sides are subtracted
+        // instead, which gives the derivative of the interpolation with
+        // respect to the fade of that axis.
+        template <SizeType DifferenceAxis, SizeType Dimensions, SizeType Count>
+        [[nodiscard]] static constexpr
+        Float Reduce(const Array<Float, Count>& v, const Array<Float, Dimensions>& fade) noexcept
+        {
+            auto l = [&](SizeType axis, Float a, Float b)
+            {
+                return axis == DifferenceAxis ? b - a : Lerp(fade[axis], a, b);
+            };
+
+            if constexpr (Dimensions == 2)
+            {
+                return l(1, l(0, v[0], v[1]),
+                            l(0, v[2], v[3]));
+            }
+            else if constexpr (Dimensions == 3)
+            {
+                return l(2, l(1, l(0, v[0], v[1]),
+                                 l(0, v[2], v[3])),
+                            l(1, l(0, v[4], v[5]),
+                                 l(0, v[6], v[7])));
+            }
+            else
+            {
+                return l(3, l(2, l(1, l(0, v[0],  v[1]),
+                                      l(0, v[2],  v[3])),
+                                 l(1, l(0, v[4],  v[5]),
+                                      l(0, v[6],  v[7]))),
+                            l(2, l(1, l(0, v[8],  v[9]),
+                                      l(0, v[10], v[11])),
+                                 l(1, l(0, v[12], v[13]),
+                                      l(0, v[14], v[15]))));
+            }
+        }
+
+        // Note(3011): The corners are in the same order as in operator(),
+        // with x changing fastest, so the value is bit for bit the same. The
+        // dot product of a corner gradient with the offset is linear, its
+        // gradient is the corner gradient itself. On top of interpolating
+        // those, the fade along an axis adds its derivative times the
+        // difference between the two sides of the cell. The gradients are
+        // stored per axis, so the dot products run over all corners at once.
+        template <bool Periodic, SizeType Dimensions>
+        [[nodiscard]] constexpr
+        Interpolant<Dimensions> InterpolateWithGradient(const Array<Float, Dimensions>& in) const noexcept
+        {
+            constexpr SizeType cornerCount = SizeType(1) << ToUnderlying(Dimensions);
+
+            Array<Cell, Dimensions> cell;
+            Array<Float, Dimensions> local;
+            Array<Float, Dimensions> fade;
+            for (SizeType axis = 0; axis < Dimensions; ++axis)
+            {
+                cell[axis] = CellIndex<Periodic>(in[axis]);
+                local[axis] = LocalCoordinate<Periodic>(in[axis]);
+                fade[axis] = Smootherstep(local[axis], Float(0), Float(1));
+            }
+
+            Array<Float, cornerCount> values;
+            Array<Array<Float, cornerCount>, Dimensions> gradients;
+            for (SizeType corner = 0; corner < cornerCount; ++corner)
+            {
+                Array<Float, Dimensions> gradient = CornerGradient<Dimensions>(CornerHash<Periodic, Dimensions>(cell, corner));
+                for (SizeType axis = 0; axis < Dimensions; ++axis)
+                {
+                    gradients[axis][corner] = gradient[axis];
+                }
+            }
+            for (SizeType axis = 0; axis < Dimensions; ++axis)
+            {
+                for (SizeType corner = 0; corner < cornerCount; ++corner)
+                {
+                    values[corner] += gradients[axis][corner] * (local[axis] - Cast<Float>((corner >> axis) & 1));
+                }
+            }
+
+            Interpolant<Dimensions> result;
+            result.Value = Reduce<Dimensions>(values, fade);
+            result.Gradient[0] = PartialDerivative<0>(values, gradients, local, fade);
+            result.Gradient[1] = PartialDerivative<1>(values, gradients, local, fade);
+            if constexpr (Dimensions > 2)
+            {
+                result.Gradient[2] = PartialDerivative<2>(values, gradients, local, fade);
+            }
+            if constexpr (Dimensions > 3)
+            {
+                result.Gradient[3] = PartialDerivative<3>(values, gradients, local, fade);
+            }
+            return result;
+        }
+
+        template <SizeType Axis, SizeType Dimensions, SizeType Count>
+        [[nodiscard]] static constexpr
+        Float PartialDerivative(const Array<Float, Count>& values, const Array<Array<Float, Count>, Dimensions>& gradients,
+                                const Array<Float, Dimensions>& local, const Array<Float, Dimensions>& fade) noexcept
+        {
+            Float fadeDerivative = SmootherstepDerivative(local[Axis], Float(0), Float(1));
+            return Reduce<Dimensions>(gradients[Axis], fade) + fadeDerivative * Reduce<Axis>(values, fade);
+        }
+
+        template <bool Periodic, SizeType Dimensions>
+        [[nodiscard]] constexpr
+        u8 CornerHash(const Array<Cell, Dimensions>& cell, SizeType corner) const noexcept
+        {
+            u8 i = Cast<u8>(corner & 1);
+            u8 j = Cast<u8>((corner >> 1) & 1);
+            if constexpr (Dimensions == 2)
+            {
+                return Hash2<Periodic>(cell[0], cell[1], i, j);
+            }
+            else if constexpr (Dimensions == 3)
+            {
+                return Hash3<Periodic>(cell[0], cell[1], cell[2], i, j, Cast<u8>(corner >> 2));
+            }
+            else
+            {
+                return Hash4<Periodic>(cell[0], cell[1], cell[2], cell[3], i, j, Cast<u8>((corner >> 2) & 1), Cast<u8>(corner >> 3));
+            }
+        }
+
+        template <SizeType Dimensions>
+        [[nodiscard]] static constexpr
+        Array<Float, Dimensions> CornerGradient(u8 hash) noexcept
+        {
+            using namespace Implementation;
+            if constexpr (Dimensions == 2)
+            {
+                SizeType index = Cast<SizeType>(hash & 7);
+                return Array<Float, 2>(Cast<Float>(sGradient2X[index]), Cast<Float>(sGradient2Y[index]));
+            }
+            else if constexpr (Dimensions == 3)
+            {
+                SizeType index = Cast<SizeType>(hash & 15);
+                return Array<Float, 3>(Cast<Float>(sGradient3X[index]), Cast<Float>(sGradient3Y[index]), Cast<Float>(sGradient3Z[index]));
+            }
+            else
+            {
+                SizeType index = Cast<SizeType>(hash & 31);
+                return Array<Float, 4>(Cast<Float>(sGradient4X[index]), Cast<Float>(sGradient4Y[index]),
+                                       Cast<Float>(sGradient4Z[index]), Cast<Float>(sGradient4W[index]));
+            }
+        }
+
+        template <bool Periodic>
         [[nodiscard]] constexpr
-        Float Grad(u8 hash, Float x, Float y, Float z) const noexcept
+        u8 Hash2(Cell x, Cell y, u8 i = 0, u8 j = 0) const noexcept
         {
-            hash &= 15;
-            Float u = (hash < 8) ? x : y;
-            Float v = (hash < 4) ? y : (hash == 12 || hash == 14) ? x : z;
-            return (!ToUnderlying(hash & 1) ? u : -u)
-                 + (!ToUnderlying(hash & 2) ? v : -v);
+            return mHasher.Hash(Neighbor<Periodic>(x, i), Neighbor<Periodic>(y, j));
         }
 
+        template <bool Periodic>
         [[nodiscard]] constexpr
-        Float Grad(u8 hash, Float x, Float y, Float z, Float w) const noexcept
+        u8 Hash3(Cell x, Cell y, Cell z, u8 i = 0, u8 j = 0, u8 k = 0) const noexcept
         {
-            hash &= 31;
-            Float t = (hash < 24) ? x : y;
-            Float u = (hash < 16) ? y : z;
-            Float v = (hash < 8) ? z : w;
-            return (!ToUnderlying(hash & 1) ? t : -t)
-                 + (!ToUnderlying(hash & 2) ? u : -u)
-                 + (!ToUnderlying(hash & 4) ? v : -v);
+            return mHasher.Hash(Neighbor<Periodic>(x, i), Neighbor<Periodic>(y, j), Neighbor<Periodic>(z, k));
         }
 
-        Array<u8, 256> mPermutation;
+        template <bool Periodic>
+        [[nodiscard]] constexpr
+        u8 Hash4(Cell x, Cell y, Cell z, Cell w, u8 i = 0, u8 j = 0, u8 k = 0, u8 l = 0) const noexcept
+        {
+            return mHasher.Hash(Neighbor<Periodic>(x, i), Neighbor<Periodic>(y, j), Neighbor<Periodic>(z, k), Neighbor<Periodic>(w, l));
+        }
+
+        // Note(3011): The results are bit for bit the same as Ken Perlin's
+        // reference implementation, multiplying by 0 or 1 is exact.
+        [[nodiscard]] static constexpr
+        Float Grad(u8 hash, Float x, Float y) noexcept
+        {
+            return Implementation::Grad(hash, x, y);
+        }
+
+        [[nodiscard]] static constexpr
+        Float Grad(u8 hash, Float x, Float y, Float z) noexcept
+        {
+            return Implementation::Grad(hash, x, y, z);
+        }
+
+        [[nodiscard]] static constexpr
+        Float Grad(u8 hash, Float x, Float y, Float z, Float w) noexcept
+        {
+            return Implementation::Grad(hash, x, y, z, w);
+        }
 
-        static constexpr Array<u8, 256> sDefaultPermutation = Array<u8, 256>(
-            151, 160, 137, 91,  90,  15,  131, 13,  201, 95,  96,  53,  194, 233, 7,   225,
-            140, 36,  103, 30,  69,  142, 8,   99,  37,  240, 21,  10,  23,  190, 6,   148,
-            247, 120, 234, 75,  0,   26,  197, 62,  94,  252, 219, 203, 117, 35,  11,  32,
-            57,  177, 33,  88,  237, 149, 56,  87,  174, 20,  125, 136, 171, 168, 68,  175,
-            74,  165, 71,  134, 139, 48,  27,  166, 77,  146, 158, 231, 83,  111, 229, 122,
-            60,  211, 133, 230, 220, 105, 92,  41,  55,  46,  245, 40,  244, 102, 143, 54,
-            65,  25,  63,  161, 1,   216, 80,  73,  209, 76, 132,  187, 208, 89,  18,  169,
-            200, 196, 135, 130, 116, 188, 159, 86,  164, 100, 109, 198, 173, 186, 3,   64,
-            52,  217, 226, 250, 124, 123, 5,   202, 38,  147, 118, 126, 255, 82,  85,  212,
-            207, 206, 59,  227, 47,  16,  58,  17,  182, 189, 28,  42,  223, 183, 170, 213,
-            119, 248, 152, 2,   44,  154, 163, 70,  221, 153, 101, 155, 167, 43,  172, 9,
-            129, 22,  39,  253, 19,  98,  108, 110, 79,  113, 224, 232, 178, 185, 112, 104,
-            218, 246, 97,  228, 251, 34,  242, 193, 238, 210, 144, 12,  191, 179, 162, 241,
-            81,  51,  145, 235, 249, 14,  239, 107, 49,  192, 214, 31,  181, 199, 106, 157,
-            184, 84,  204, 176, 115, 121, 50,  45,  127, 4,   150, 254, 138, 236, 205, 93,
-            222, 114, 67,  29,  24,  72,  243, 141, 128, 195, 78,  66,  215, 61,  156, 180
-        );
+        Hasher mHasher;
+        SizeType mPeriod;
     };
 }
 
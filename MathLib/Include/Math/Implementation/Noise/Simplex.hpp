@@ -1,9 +1,25 @@
 #ifndef MATHLIB_IMPLEMENTATION_NOISE_SIMPLEX_HPP
 #define MATHLIB_IMPLEMENTATION_NOISE_SIMPLEX_HPP
 
+// Note(3011):
+// Gradient noise on simplex style lattices, following the construction of
+// K. Jordan's OpenSimplex2 (public domain). Unlike Perlin noise, every point
+// only sums the radial falloff of a few nearby lattice points:
+//   2D: the 3 corners of the surrounding triangle.
+//   3D: 4 points of a body centered cubic lattice (two offset cubic grids),
+//       instead of the 4 corners of a tetrahedron of the skewed cubic grid.
+//   4D: 5 points, one from each of five offset copies of the A4 lattice.
+// The 3D and 4D lattices are not the ones covered by the (now expired) US
+// patent 6,867,776 on simplex noise.
+// Lattice points are hashed with the same seeded permutation and gradient
+// tables as Perlin noise. Values are mapped onto [0, 1].
+
 #include "../Base/Array.hpp"
-#include "../../Random.hpp"
+#include "../../Functions.hpp"
 #include "../../Vector.hpp"
+#include "Lattice.hpp"
+
+#include <span>
 
 namespace Math::Noise
 {
@@ -15,26 +31,587 @@ namespace Math::Noise
 
         [[nodiscard]] constexpr explicit
         Simplex(u64 seed = 0) noexcept
+            : mPermutation(seed)
         {}
 
+        // Note(3011): The same noise with another seed, Layer builds its
+        // octaves with it.
+        [[nodiscard]] constexpr
+        Simplex Reseeded(u64 seed) const noexcept
+        {
+            return Simplex(seed);
+        }
+
         [[nodiscard]] constexpr
         Float operator()(const Vector2T<Float>& in) const noexcept
         {
-            return Float(0);
+            return Sum(Locate(in));
         }
 
         [[nodiscard]] constexpr
         Float operator()(const Vector3T<Float>& in) const noexcept
         {
-            return Float(0);
+            return Sum(Locate(in));
         }
 
         [[nodiscard]] constexpr
         Float operator()(const Vector4T<Float>& in) const noexcept
         {
-            return Float(0);
+            return Sum(Locate(in));
+        }
+
+        // Note(3011): The value, exactly as returned by operator(), and its
+        // analytic gradient, summed from the same lattice points. Where the
+        // value is clamped to 0 or 1, the gradient is 0.
+        [[nodiscard]] constexpr
+        ValueWithGradient<Vector2T<Float>> EvaluateWithGradient(const Vector2T<Float>& in) const noexcept
+        {
+            auto [value, gradient] = SumWithGradient(Locate(in));
+            return { value, Vector2T<Float>(gradient[0], gradient[1]) };
+        }
+
+        // Note(3011): The offsets of the 3D lattice points are taken after
+        // reflecting the input, the reflection is its own transpose.
+        [[nodiscard]] constexpr
+        ValueWithGradient<Vector3T<Float>> EvaluateWithGradient(const Vector3T<Float>& in) const noexcept
+        {
+            auto [value, gradient] = SumWithGradient(Locate(in));
+            Float r = (gradient[0] + gradient[1] + gradient[2]) * Float(2) / Float(3);
+            return { value, Vector3T<Float>(r - gradient[0], r - gradient[1], r - gradient[2]) };
+        }
+
+        [[nodiscard]] constexpr
+        ValueWithGradient<Vector4T<Float>> EvaluateWithGradient(const Vector4T<Float>& in) const noexcept
+        {
+            auto [value, gradient] = SumWithGradient(Locate(in));
+            return { value, Vector4T<Float>(gradient[0], gradient[1], gradient[2], gradient[3]) };
+        }
+
+        // Note(3011): The batch versions produce exactly the same values as
+        // evaluating every point on its own. Points are processed in blocks of
+        // BatchSize lanes: locating the lattice points and hashing them is
+        // done first, then the falloff sums run over the whole block without
+        // branches, so the compiler can vectorize that part.
+        static constexpr SizeType BatchSize = 8;
+
+        constexpr
+        void Evaluate(std::span<const Vector2T<Float>> points, std::span<Float> values) const noexcept
+        {
+            EvaluateBlocks(points, values);
         }
+
+        constexpr
+        void Evaluate(std::span<const Vector3T<Float>> points, std::span<Float> values) const noexcept
+        {
+            EvaluateBlocks(points, values);
+        }
+
+        constexpr
+        void Evaluate(std::span<const Vector4T<Float>> points, std::span<Float> values) const noexcept
+        {
+            EvaluateBlocks(points, values);
+        }
+
+        // Note(3011): Samples origin + step * (x, y) for all x < dims.x and
+        // y < dims.y, row by row with x being the fastest changing index.
+        // values has to hold all samples of the grid or nothing is written.
+        constexpr
+        void FillGrid(const Vector2T<Float>& origin, const Vector2T<Float>& step, const Vector2T<SizeType>& dims, std::span<Float> values) const noexcept
+        {
+            if (SizeType(values.size()) < dims.x * dims.y)
+            {
+                return;
+            }
+
+            Float* out = values.data();
+            for (SizeType y = 0; y < dims.y; ++y)
+            {
+                Float py = origin.y + step.y * Cast<Float>(y);
+                for (SizeType begin = 0; begin < dims.x; begin += BatchSize)
+                {
+                    SizeType lanes = Min(BatchSize, dims.x - begin);
+                    Block<2, 3> block;
+                    for (SizeType lane = 0; lane < lanes; ++lane)
+                    {
+                        Float px = origin.x + step.x * Cast<Float>(begin + lane);
+                        block.Store(Locate(Vector2T<Float>(px, py)), lane);
+                    }
+                    SumBlock(block, lanes, out);
+                    out += ToUnderlying(lanes);
+                }
+            }
+        }
+
+        constexpr
+        void FillGrid(const Vector3T<Float>& origin, const Vector3T<Float>& step, const Vector3T<SizeType>& dims, std::span<Float> values) const noexcept
+        {
+            if (SizeType(values.size()) < dims.x * dims.y * dims.z)
+            {
+                return;
+            }
+
+            Float* out = values.data();
+            for (SizeType z = 0; z < dims.z; ++z)
+            {
+                Float pz = origin.z + step.z * Cast<Float>(z);
+                for (SizeType y = 0; y < dims.y; ++y)
+                {
+                    Float py = origin.y + step.y * Cast<Float>(y);
+                    for (SizeType begin = 0; begin < dims.x; begin += BatchSize)
+                    {
+                        SizeType lanes = Min(BatchSize, dims.x - begin);
+                        Block<3, 4> block;
+                        for (SizeType lane = 0; lane < lanes; ++lane)
+                        {
+                            Float px = origin.x + step.x * Cast<Float>(begin + lane);
+                            block.Store(Locate(Vector3T<Float>(px, py, pz)), lane);
+                        }
+                        SumBlock(block, lanes, out);
+                        out += ToUnderlying(lanes);
+                    }
+                }
+            }
+        }
+
     private:
+        using Int = SignedIntegerSelector<sizeof(Float)>;
+
+        template <SizeType Dimensions, SizeType Count>
+        struct Block;
+
+        // Note(3011): Offsets from, and gradients of, the lattice points that
+        // can contribute to a sample. Points out of reach are still listed,
+        // their falloff is clamped to 0.
+        template <SizeType Dimensions, SizeType Count>
+        struct Corners
+        {
+            using BlockType = Block<Dimensions, Count>;
+
+            Array<Array<Float, Count>, Dimensions> Offset;
+            Array<Array<Float, Count>, Dimensions> Gradient;
+        };
+
+        template <SizeType Dimensions, SizeType Count>
+        struct Block
+        {
+            constexpr
+            void Store(const Corners<Dimensions, Count>& corners, SizeType lane) noexcept
+            {
+                for (SizeType axis = 0; axis < Dimensions; ++axis)
+                {
+                    for (SizeType corner = 0; corner < Count; ++corner)
+                    {
+                        Offset[axis][corner][lane] = corners.Offset[axis][corner];
+                        Gradient[axis][corner][lane] = corners.Gradient[axis][corner];
+                    }
+                }
+            }
+
+            Array<Array<Array<Float, BatchSize>, Count>, Dimensions> Offset;
+            Array<Array<Array<Float, BatchSize>, Count>, Dimensions> Gradient;
+        };
+
+        // Note(3011): Squared radius of the falloff around a lattice point.
+        // With 1/2, only the points listed by Locate can be in reach, so the
+        // noise stays continuous. The scale maps the sums to about [-1, 1],
+        // it was measured over a large number of random samples.
+        static constexpr Float sRadius2 = Float(0.5);
+
+        template <SizeType Dimensions>
+        [[nodiscard]] static constexpr
+        Float Scale() noexcept
+        {
+            if constexpr (Dimensions == 2)
+            {
+                return Float(45);
+            }
+            else if constexpr (Dimensions == 3)
+            {
+                return Float(76);
+            }
+            else
+            {
+                return Float(62);
+            }
+        }
+
+        // Note(3011): Comparisons on the raw values. The three way comparison
+        // of the strong types is compiled into branches, which would be
+        // mispredicted all the time here.
+        [[nodiscard]] static constexpr
+        bool Greater(Float a, Float b) noexcept
+        {
+            return ToUnderlying(a) > ToUnderlying(b);
+        }
+
+        [[nodiscard]] static constexpr
+        bool GreaterEqual(Float a, Float b) noexcept
+        {
+            return ToUnderlying(a) >= ToUnderlying(b);
+        }
+
+        struct Pair
+        {
+            Float Offset;
+            Float Gradient;
+        };
+
+        template <SizeType Dimensions, typename Load>
+        [[nodiscard]] static constexpr
+        Float Contribution(Load load) noexcept
+        {
+            Float falloff = sRadius2;
+            Float dot = Float(0);
+            for (SizeType axis = 0; axis < Dimensions; ++axis)
+            {
+                auto [offset, gradient] = load(axis);
+                falloff -= offset * offset;
+                dot += offset * gradient;
+            }
+            falloff = Greater(falloff, Float(0)) ? falloff : Float(0);
+            falloff *= falloff;
+            return falloff * falloff * dot;
+        }
+
+        template <SizeType Dimensions>
+        [[nodiscard]] static constexpr
+        Float Normalize(Float value) noexcept
+        {
+            value = (value * Scale<Dimensions>() + 1) / 2;
+            value = Greater(value, Float(0)) ? value : Float(0);
+            return Greater(value, Float(1)) ? Float(1) : value;
+        }
+
+        template <SizeType Dimensions, SizeType Count>
+        [[nodiscard]] static constexpr
+        Float Sum(const Corners<Dimensions, Count>& corners) noexcept
+        {
+            Float value = Float(0);
+            for (SizeType corner = 0; corner < Count; ++corner)
+            {
+                value += Contribution<Dimensions>([&](SizeType axis)
+                {
+                    return Pair{corners.Offset[axis][corner], corners.Gradient[axis][corner]};
+                });
+            }
+            return Normalize<Dimensions>(value);
+        }
+
+        template <SizeType Dimensions>
+        struct SumAndGradient
+        {
+            Float Value;
+            Array<Float, Dimensions> Gradient;
+        };
+
+        // Note(3011): With the falloff f = r^2 - |o|^2 around a lattice point
+        // at offset o, its contribution f^4 (g . o) has the gradient
+        // f^4 g - 8 f^3 (g . o) o. In 2D and 4D the offsets are differences
+        // of input coordinates (skewing and unskewing cancel out), so this is
+        // the gradient with respect to the input as well.
+        template <SizeType Dimensions, SizeType Count>
+        [[nodiscard]] static constexpr
+        SumAndGradient<Dimensions> SumWithGradient(const Corners<Dimensions, Count>& corners) noexcept
+        {
+            Float value = Float(0);
+            Array<Float, Dimensions> gradient;
+            for (SizeType corner = 0; corner < Count; ++corner)
+            {
+                Float falloff = sRadius2;
+                Float dot = Float(0);
+                for (SizeType axis = 0; axis < Dimensions; ++axis)
+                {
+                    Float offset = corners.Offset[axis][corner];
+                    falloff -= offset * offset;
+                    dot += offset * corners.Gradient[axis][corner];
+                }
+                falloff = Greater(falloff, Float(0)) ? falloff : Float(0);
+                Float falloff2 = falloff * falloff;
+                Float falloff4 = falloff2 * falloff2;
+                value += falloff4 * dot;
+
+                Float radial = Float(8) * falloff2 * falloff * dot;
+                for (SizeType axis = 0; axis < Dimensions; ++axis)
+                {
+                    gradient[axis] += falloff4 * corners.Gradient[axis][corner] - radial * corners.Offset[axis][corner];
+                }
+            }
+
+            Float normalized = Normalize<Dimensions>(value);
+            Float scale = Scale<Dimensions>() / Float(2);
+            bool clamped = !Greater(normalized, Float(0)) || !Greater(Float(1), normalized);
+            for (SizeType axis = 0; axis < Dimensions; ++axis)
+            {
+                gradient[axis] = clamped ? Float(0) : gradient[axis] * scale;
+            }
+            return { normalized, gradient };
+        }
+
+        template <SizeType Dimensions, SizeType Count>
+        static constexpr
+        void SumBlock(const Block<Dimensions, Count>& block, SizeType lanes, Float* out) noexcept
+        {
+            for (SizeType lane = 0; lane < lanes; ++lane)
+            {
+                Float value = Float(0);
+                for (SizeType corner = 0; corner < Count; ++corner)
+                {
+                    value += Contribution<Dimensions>([&](SizeType axis)
+                    {
+                        return Pair{block.Offset[axis][corner][lane], block.Gradient[axis][corner][lane]};
+                    });
+                }
+                out[ToUnderlying(lane)] = Normalize<Dimensions>(value);
+            }
+        }
+
+        template <typename Point>
+        constexpr
+        void EvaluateBlocks(std::span<const Point> points, std::span<Float> values) const noexcept
+        {
+            using Located = decltype(Locate(points[0]));
+            SizeType count = Min(SizeType(points.size()), SizeType(values.size()));
+            for (SizeType begin = 0; begin < count; begin += BatchSize)
+            {
+                SizeType lanes = Min(BatchSize, count - begin);
+                typename Located::BlockType block;
+                for (SizeType lane = 0; lane < lanes; ++lane)
+                {
+                    block.Store(Locate(points[ToUnderlying(begin + lane)]), lane);
+                }
+                SumBlock(block, lanes, values.data() + ToUnderlying(begin));
+            }
+        }
+
+        // Note(3011): Triangular lattice. Skewing maps the triangles onto the
+        // halves of the unit squares, the two corners (0, 0) and (1, 1) are
+        // always part of the simplex and the third one depends on which half
+        // the point is in.
+        [[nodiscard]] constexpr
+        Corners<2, 3> Locate(const Vector2T<Float>& in) const noexcept
+        {
+            constexpr Float skew = Float(0.366025403784438646763723170752936183); // (sqrt(3) - 1) / 2
+            constexpr Float unskew = Float(-0.211324865405187117745425609748864); // (1 / sqrt(3) - 1) / 2
+
+            Float s = (in.x + in.y) * skew;
+            Float xs = in.x + s;
+            Float ys = in.y + s;
+            Int xb = Floor<Int>(xs);
+            Int yb = Floor<Int>(ys);
+            Float xi = xs - Cast<Float>(xb);
+            Float yi = ys - Cast<Float>(yb);
+
+            Float t = (xi + yi) * unskew;
+            Float dx = xi + t;
+            Float dy = yi + t;
+            u8 xc = Implementation::LatticeIndex(xb);
+            u8 yc = Implementation::LatticeIndex(yb);
+            u8 thirdX = Greater(dy, dx) ? u8(0) : u8(1);
+            u8 thirdY = u8(1) - thirdX;
+
+            Corners<2, 3> corners;
+            SetCorner(corners, 0, mPermutation.Hash(xc, yc), dx, dy);
+            SetCorner(corners, 1, mPermutation.Hash(Offset(xc, 1), Offset(yc, 1)),
+                      dx - (1 + 2 * unskew), dy - (1 + 2 * unskew));
+            SetCorner(corners, 2, mPermutation.Hash(Offset(xc, thirdX), Offset(yc, thirdY)),
+                      dx - Cast<Float>(thirdX) - unskew, dy - Cast<Float>(thirdY) - unskew);
+            return corners;
+        }
+
+        // Note(3011): The body centered cubic lattice is the union of the
+        // integer grid (A) and the same grid shifted by 1/2 on every axis (B).
+        // Of each grid, only the closest point and its neighbor along the axis
+        // the sample is furthest out on can be within the falloff radius.
+        // The input is reflected around the main diagonal first, which
+        // aligns the lattice the way it is usually pictured.
+        // The points are picked with selects instead of branches, the choice
+        // depends on the sample alone and can't be predicted.
+        [[nodiscard]] constexpr
+        Corners<3, 4> Locate(const Vector3T<Float>& in) const noexcept
+        {
+            Float r = (in.x + in.y + in.z) * Float(2) / Float(3);
+            Array<Float, 3> p = Array<Float, 3>(r - in.x, r - in.y, r - in.z);
+
+            // Note(3011): sign is the direction of the neighbor on each axis,
+            // so offset * sign is the distance from the closest point.
+            Array<Int, 3> base;
+            Array<Float, 3> offset;
+            Array<Float, 3> sign;
+            for (SizeType axis = 0; axis < 3; ++axis)
+            {
+                base[axis] = Round<Int>(p[axis]);
+                offset[axis] = p[axis] - Cast<Float>(base[axis]);
+                sign[axis] = GreaterEqual(offset[axis], Float(0)) ? Float(1) : Float(-1);
+            }
+
+            Corners<3, 4> corners;
+            for (SizeType lattice = 0; lattice < 2; ++lattice)
+            {
+                Float dx = offset[0] * sign[0];
+                Float dy = offset[1] * sign[1];
+                Float dz = offset[2] * sign[2];
+                bool farX = GreaterEqual(dx, dy) & GreaterEqual(dx, dz);
+                bool farY = !farX & GreaterEqual(dy, dz);
+                Array<bool, 3> far = Array<bool, 3>(farX, farY, !farX & !farY);
+
+                Array<u8, 3> cell;
+                Array<u8, 3> neighborCell;
+                Array<Float, 3> neighbor;
+                for (SizeType axis = 0; axis < 3; ++axis)
+                {
+                    Int step = far[axis] ? (Greater(sign[axis], Float(0)) ? Int(1) : Int(-1)) : Int(0);
+                    cell[axis] = Implementation::LatticeIndex(base[axis]);
+                    neighborCell[axis] = Implementation::LatticeIndex(base[axis] + step);
+                    neighbor[axis] = offset[axis] - Cast<Float>(step);
+                }
+                u8 latticeHash = Cast<u8>(lattice);
+                SetCorner(corners, lattice * 2, mPermutation.Hash(cell[0], cell[1], cell[2], latticeHash), offset);
+                SetCorner(corners, lattice * 2 + 1, mPermutation.Hash(neighborCell[0], neighborCell[1], neighborCell[2], latticeHash), neighbor);
+
+                // Note(3011): The closest point of B is half a step towards
+                // the sample on every axis. It is named by the A point at its
+                // upper corner, and its neighbors lie in the other direction.
+                for (SizeType axis = 0; axis < 3; ++axis)
+                {
+                    base[axis] += Greater(sign[axis], Float(0)) ? Int(1) : Int(0);
+                    offset[axis] -= sign[axis] / Float(2);
+                    sign[axis] = -sign[axis];
+                }
+            }
+            return corners;
+        }
+
+        // Note(3011): Five copies of the A4 lattice, each shifted by another
+        // fifth of the main diagonal of the skewed grid. The walk starts at
+        // the copy whose base simplex certainly contains a contributing point
+        // and takes the closest vertex of the base simplex in every copy.
+        // As in 3D, the vertex is picked with selects instead of branches.
+        [[nodiscard]] constexpr
+        Corners<4, 5> Locate(const Vector4T<Float>& in) const noexcept
+        {
+            constexpr Float skew = Float(-0.138196601125010515179541316563436189); // (1 / sqrt(5) - 1) / 4
+            constexpr Float unskew = Float(0.309016994374947424102293417182819059); // (sqrt(5) - 1) / 4
+            constexpr Float step = Float(0.2);
+
+            Float s = (in.x + in.y + in.z + in.w) * skew;
+            Array<Float, 4> p = Array<Float, 4>(in.x + s, in.y + s, in.z + s, in.w + s);
+
+            Array<Int, 4> vertex;
+            Array<Float, 4> local;
+            Float localSum = Float(0);
+            for (SizeType axis = 0; axis < 4; ++axis)
+            {
+                vertex[axis] = Floor<Int>(p[axis]);
+                local[axis] = p[axis] - Cast<Float>(vertex[axis]);
+                localSum += local[axis];
+            }
+
+            i32 copy = Min(Cast<i32>(Trunc<Int>(localSum * Float(1.25))), i32(4));
+            Float startingOffset = Cast<Float>(copy) * -step;
+            for (SizeType axis = 0; axis < 4; ++axis)
+            {
+                local[axis] += startingOffset;
+            }
+
+            Corners<4, 5> corners;
+            for (SizeType i = 0; i < 5; ++i)
+            {
+                // Note(3011): Ties go to the lower axis, and the base vertex
+                // itself wins if no coordinate beats score0.
+                Float score0 = Float(1) - (local[0] + local[1] + local[2] + local[3]);
+                Array<Int, 4> move;
+                for (SizeType axis = 0; axis < 4; ++axis)
+                {
+                    bool closest = GreaterEqual(local[axis], score0);
+                    for (SizeType other = 0; other < 4; ++other)
+                    {
+                        if (other < axis)
+                        {
+                            closest &= Greater(local[axis], local[other]);
+                        }
+                        else if (other > axis)
+                        {
+                            closest &= GreaterEqual(local[axis], local[other]);
+                        }
+                    }
+                    move[axis] = closest ? Int(1) : Int(0);
+                }
+
+                Float unskewed = Float(0);
+                for (SizeType axis = 0; axis < 4; ++axis)
+                {
+                    vertex[axis] += move[axis];
+                    local[axis] -= Cast<Float>(move[axis]);
+                    unskewed += local[axis];
+                }
+                unskewed *= unskew;
+
+                Array<Float, 4> offset;
+                Array<u8, 4> cell;
+                for (SizeType axis = 0; axis < 4; ++axis)
+                {
+                    offset[axis] = local[axis] + unskewed;
+                    cell[axis] = Implementation::LatticeIndex(vertex[axis]);
+                }
+                SetCorner(corners, i, mPermutation.Hash(cell[0], cell[1], cell[2], cell[3], Cast<u8>(copy)), offset);
+
+                // Note(3011): Move on to the previous copy. Going below the
+                // first copy wraps around to the last one, one cell down.
+                Int wrap = (copy == i32(0)) ? Int(1) : Int(0);
+                copy = (copy == i32(0)) ? i32(4) : copy - 1;
+                for (SizeType axis = 0; axis < 4; ++axis)
+                {
+                    local[axis] += step;
+                    vertex[axis] -= wrap;
+                }
+            }
+            return corners;
+        }
+
+        [[nodiscard]] static constexpr
+        u8 Offset(u8 cell, u8 offset) noexcept
+        {
+            return Implementation::Permutation::Offset(cell, offset);
+        }
+
+        static constexpr
+        void SetCorner(Corners<2, 3>& corners, SizeType corner, u8 hash, Float x, Float y) noexcept
+        {
+            SizeType index = Cast<SizeType>(hash & 7);
+            corners.Offset[0][corner] = x;
+            corners.Offset[1][corner] = y;
+            corners.Gradient[0][corner] = Cast<Float>(Implementation::sGradient2X[index]);
+            corners.Gradient[1][corner] = Cast<Float>(Implementation::sGradient2Y[index]);
+        }
+
+        static constexpr
+        void SetCorner(Corners<3, 4>& corners, SizeType corner, u8 hash, const Array<Float, 3>& offset) noexcept
+        {
+            SizeType index = Cast<SizeType>(hash & 15);
+            for (SizeType axis = 0; axis < 3; ++axis)
+            {
+                corners.Offset[axis][corner] = offset[axis];
+            }
+            corners.Gradient[0][corner] = Cast<Float>(Implementation::sGradient3X[index]);
+            corners.Gradient[1][corner] = Cast<Float>(Implementation::sGradient3Y[index]);
+            corners.Gradient[2][corner] = Cast<Float>(Implementation::sGradient3Z[index]);
+        }
+
+        static constexpr
+        void SetCorner(Corners<4, 5>& corners, SizeType corner, u8 hash, const Array<Float, 4>& offset) noexcept
+        {
+            SizeType index = Cast<SizeType>(hash & 31);
+            for (SizeType axis = 0; axis < 4; ++axis)
+            {
+                corners.Offset[axis][corner] = offset[axis];
+            }
+            corners.Gradient[0][corner] = Cast<Float>(Implementation::sGradient4X[index]);
+            corners.Gradient[1][corner] = Cast<Float>(Implementation::sGradient4Y[index]);
+            corners.Gradient[2][corner] = Cast<Float>(Implementation::sGradient4Z[index]);
+            corners.Gradient[3][corner] = Cast<Float>(Implementation::sGradient4W[index]);
+        }
+
+        Implementation::Permutation mPermutation;
     };
 }
 
@@ -1,12 +1,41 @@
 #ifndef MATHLIB_IMPLEMENTATION_NOISE_WORLEY_HPP
 #define MATHLIB_IMPLEMENTATION_NOISE_WORLEY_HPP
 
+// Note(3011):
+// Cellular noise after S. Worley. Every cell of the integer lattice holds one
+// feature point, jittered inside the cell by hashing the cell coordinates, so
+// nothing is stored besides the permutation. A sample finds the closest (F1)
+// and second closest (F2) feature points among its own and the neighboring
+// cells.
+// With a single feature point per cell, F1 is always found among the direct
+// neighbors. F2 can lie one cell further out in rare configurations, which
+// shows up as a small error of F2, as in most implementations.
+// Distances are in cell units, clamped to [0, 1]. Manhattan distances are
+// divided by sqrt(D), they would be saturated most of the time otherwise.
+
 #include "../Base/Array.hpp"
-#include "../../Random.hpp"
+#include "../../Functions.hpp"
 #include "../../Vector.hpp"
+#include "Lattice.hpp"
+
+#include <span>
 
 namespace Math::Noise
 {
+    enum class WorleyMetric
+    {
+        Euclidean,
+        Manhattan,
+        Chebyshev
+    };
+
+    enum class WorleyFeature
+    {
+        F1,
+        F2,
+        F2MinusF1
+    };
+
     template <Concept::FloatingPointType Float>
     class Worley final
     {
@@ -14,27 +43,535 @@ namespace Math::Noise
         using ValueType = Float;
 
         [[nodiscard]] constexpr explicit
-        Worley(u64 seed = 0) noexcept
+        Worley(u64 seed = 0, WorleyFeature feature = WorleyFeature::F1, WorleyMetric metric = WorleyMetric::Euclidean) noexcept
+            : mPermutation(seed), mFeature(feature), mMetric(metric)
         {}
 
+        [[nodiscard]] constexpr
+        WorleyFeature Feature() const noexcept
+        {
+            return mFeature;
+        }
+
+        [[nodiscard]] constexpr
+        WorleyMetric Metric() const noexcept
+        {
+            return mMetric;
+        }
+
+        // Note(3011): Keeps the feature and the metric, only the seed
+        // changes.
+        [[nodiscard]] constexpr
+        Worley Reseeded(u64 seed) const noexcept
+        {
+            return Worley(seed, mFeature, mMetric);
+        }
+
         [[nodiscard]] constexpr
         Float operator()(const Vector2T<Float>& in) const noexcept
         {
-            return Float(0);
+            return EvaluateOne<2>(Array<Float, 2>(in.x, in.y));
         }
 
         [[nodiscard]] constexpr
         Float operator()(const Vector3T<Float>& in) const noexcept
         {
-            return Float(0);
+            return EvaluateOne<3>(Array<Float, 3>(in.x, in.y, in.z));
         }
 
         [[nodiscard]] constexpr
         Float operator()(const Vector4T<Float>& in) const noexcept
         {
-            return Float(0);
+            return EvaluateOne<4>(Array<Float, 4>(in.x, in.y, in.z, in.w));
+        }
+
+        // Note(3011): The value, exactly as returned by operator(), and its
+        // gradient. Where the value is clamped to 1, the gradient is 0.
+        [[nodiscard]] constexpr
+        ValueWithGradient<Vector2T<Float>> EvaluateWithGradient(const Vector2T<Float>& in) const noexcept
+        {
+            FeatureGradient<2> result = EvaluateWithGradientOne<2>(Array<Float, 2>(in.x, in.y));
+            return { result.Value, Vector2T<Float>(result.Gradient[0], result.Gradient[1]) };
         }
+
+        [[nodiscard]] constexpr
+        ValueWithGradient<Vector3T<Float>> EvaluateWithGradient(const Vector3T<Float>& in) const noexcept
+        {
+            FeatureGradient<3> result = EvaluateWithGradientOne<3>(Array<Float, 3>(in.x, in.y, in.z));
+            return { result.Value, Vector3T<Float>(result.Gradient[0], result.Gradient[1], result.Gradient[2]) };
+        }
+
+        [[nodiscard]] constexpr
+        ValueWithGradient<Vector4T<Float>> EvaluateWithGradient(const Vector4T<Float>& in) const noexcept
+        {
+            FeatureGradient<4> result = EvaluateWithGradientOne<4>(Array<Float, 4>(in.x, in.y, in.z, in.w));
+            return { result.Value, Vector4T<Float>(result.Gradient[0], result.Gradient[1], result.Gradient[2], result.Gradient[3]) };
+        }
+
+        // Note(3011): The batch versions produce exactly the same values as
+        // evaluating every point on its own. The feature points around the
+        // previous sample are kept: a sample in the same cell reuses all of
+        // them, and a step of one cell along x only hashes the new column.
+        // Coherent inputs (scanlines, grids) therefore hash about one cell
+        // column per cell instead of the whole neighborhood per sample.
+        constexpr
+        void Evaluate(std::span<const Vector2T<Float>> points, std::span<Float> values) const noexcept
+        {
+            EvaluateMany<2>(points, values, [](const Vector2T<Float>& point) { return Array<Float, 2>(point.x, point.y); });
+        }
+
+        constexpr
+        void Evaluate(std::span<const Vector3T<Float>> points, std::span<Float> values) const noexcept
+        {
+            EvaluateMany<3>(points, values, [](const Vector3T<Float>& point) { return Array<Float, 3>(point.x, point.y, point.z); });
+        }
+
+        constexpr
+        void Evaluate(std::span<const Vector4T<Float>> points, std::span<Float> values) const noexcept
+        {
+            EvaluateMany<4>(points, values, [](const Vector4T<Float>& point) { return Array<Float, 4>(point.x, point.y, point.z, point.w); });
+        }
+
+        // Note(3011): Samples origin + step * (x, y) for all x < dims.x and
+        // y < dims.y, row by row with x being the fastest changing index.
+        // values has to hold all samples of the grid or nothing is written.
+        constexpr
+        void FillGrid(const Vector2T<Float>& origin, const Vector2T<Float>& step, const Vector2T<SizeType>& dims, std::span<Float> values) const noexcept
+        {
+            if (SizeType(values.size()) < dims.x * dims.y)
+            {
+                return;
+            }
+
+            Float* out = values.data();
+            for (SizeType y = 0; y < dims.y; ++y)
+            {
+                Float py = origin.y + step.y * Cast<Float>(y);
+                Neighborhood<2> neighborhood;
+                for (SizeType x = 0; x < dims.x; ++x)
+                {
+                    *out++ = EvaluateIn(neighborhood, Array<Float, 2>(origin.x + step.x * Cast<Float>(x), py));
+                }
+            }
+        }
+
+        constexpr
+        void FillGrid(const Vector3T<Float>& origin, const Vector3T<Float>& step, const Vector3T<SizeType>& dims, std::span<Float> values) const noexcept
+        {
+            if (SizeType(values.size()) < dims.x * dims.y * dims.z)
+            {
+                return;
+            }
+
+            Float* out = values.data();
+            for (SizeType z = 0; z < dims.z; ++z)
+            {
+                Float pz = origin.z + step.z * Cast<Float>(z);
+                for (SizeType y = 0; y < dims.y; ++y)
+                {
+                    Float py = origin.y + step.y * Cast<Float>(y);
+                    Neighborhood<3> neighborhood;
+                    for (SizeType x = 0; x < dims.x; ++x)
+                    {
+                        *out++ = EvaluateIn(neighborhood, Array<Float, 3>(origin.x + step.x * Cast<Float>(x), py, pz));
+                    }
+                }
+            }
+        }
+
     private:
+        using Int = SignedIntegerSelector<sizeof(Float)>;
+
+        template <SizeType Dimensions>
+        using Point = ConditionalType<Dimensions == 2, Vector2T<Float>,
+                      ConditionalType<Dimensions == 3, Vector3T<Float>, Vector4T<Float>>>;
+
+        // Note(3011): The 3^D cells around (and including) the cell of a
+        // sample, with x being the fastest changing index. Only the jitter of
+        // every feature point is stored, its cell is implied by the index.
+        template <SizeType Dimensions>
+        struct Neighborhood
+        {
+            static constexpr SizeType Count = Dimensions == 2 ? 9 : (Dimensions == 3 ? 27 : 81);
+
+            Array<Int, Dimensions> Cell;
+            Array<Array<Float, Count>, Dimensions> Jitter;
+            bool Valid = false;
+        };
+
+        template <SizeType Dimensions>
+        [[nodiscard]] static constexpr
+        Array<Array<Float, Neighborhood<Dimensions>::Count>, Dimensions> MakeCellOffsets() noexcept
+        {
+            Array<Array<Float, Neighborhood<Dimensions>::Count>, Dimensions> offsets;
+            for (SizeType index = 0; index < Neighborhood<Dimensions>::Count; ++index)
+            {
+                SizeType rest = index;
+                for (SizeType axis = 0; axis < Dimensions; ++axis)
+                {
+                    offsets[axis][index] = Cast<Float>(Cast<Int>(rest % 3)) - Float(1);
+                    rest /= 3;
+                }
+            }
+            return offsets;
+        }
+
+        template <SizeType Dimensions>
+        static constexpr Array<Array<Float, Neighborhood<Dimensions>::Count>, Dimensions> sCellOffsets = MakeCellOffsets<Dimensions>();
+
+        [[nodiscard]] static constexpr
+        Int FloorToInt(Float value) noexcept
+        {
+            Int truncated = Trunc<Int>(value);
+            return truncated - (ToUnderlying(Cast<Float>(truncated)) > ToUnderlying(value) ? Int(1) : Int(0));
+        }
+
+        template <SizeType Dimensions>
+        [[nodiscard]] constexpr
+        Float EvaluateOne(const Array<Float, Dimensions>& in) const noexcept
+        {
+            Neighborhood<Dimensions> neighborhood;
+            return EvaluateIn(neighborhood, in);
+        }
+
+        template <SizeType Dimensions, typename Convert>
+        constexpr
+        void EvaluateMany(std::span<const Point<Dimensions>> points, std::span<Float> values, Convert convert) const noexcept
+        {
+            SizeType count = Min(SizeType(points.size()), SizeType(values.size()));
+            Neighborhood<Dimensions> neighborhood;
+            for (SizeType i = 0; i < count; ++i)
+            {
+                values[ToUnderlying(i)] = EvaluateIn(neighborhood, convert(points[ToUnderlying(i)]));
+            }
+        }
+
+        template <SizeType Dimensions>
+        [[nodiscard]] constexpr
+        Float EvaluateIn(Neighborhood<Dimensions>& neighborhood, const Array<Float, Dimensions>& in) const noexcept
+        {
+            Array<Int, Dimensions> cell;
+            Array<Float, Dimensions> local;
+            for (SizeType axis = 0; axis < Dimensions; ++axis)
+            {
+                cell[axis] = FloorToInt(in[axis]);
+                local[axis] = in[axis] - Cast<Float>(cell[axis]);
+            }
+            MoveTo(neighborhood, cell);
+
+            switch (mMetric)
+            {
+            case WorleyMetric::Manhattan:
+                return Combine(Closest<WorleyMetric::Manhattan>(neighborhood, local));
+            case WorleyMetric::Chebyshev:
+                return Combine(Closest<WorleyMetric::Chebyshev>(neighborhood, local));
+            default:
+                Array<Float, 2> closest = Closest<WorleyMetric::Euclidean>(neighborhood, local);
+                return Combine(Array<Float, 2>(Sqrt(closest[0]), Sqrt(closest[1])));
+            }
+        }
+
+        using Raw = UnderlyingType<Float>;
+
+        // Note(3011): Feature point minus sample, along one axis.
+        template <SizeType Dimensions>
+        [[nodiscard]] static constexpr
+        Raw Delta(const Neighborhood<Dimensions>& neighborhood, const Array<Float, Dimensions>& local, SizeType index, SizeType axis) noexcept
+        {
+            return ToUnderlying(sCellOffsets<Dimensions>[axis][index] + neighborhood.Jitter[axis][index] - local[axis]);
+        }
+
+        // Note(3011): For the Euclidean metric, the distance is squared and
+        // for the Manhattan metric, it is not yet divided by sqrt(D).
+        template <WorleyMetric DistanceMetric, SizeType Dimensions>
+        [[nodiscard]] static constexpr
+        Raw Distance(const Neighborhood<Dimensions>& neighborhood, const Array<Float, Dimensions>& local, SizeType index) noexcept
+        {
+            Raw distance = Raw(0);
+            for (SizeType axis = 0; axis < Dimensions; ++axis)
+            {
+                Raw delta = Delta(neighborhood, local, index, axis);
+                if constexpr (DistanceMetric == WorleyMetric::Euclidean)
+                {
+                    distance += delta * delta;
+                }
+                else
+                {
+                    delta = delta < Raw(0) ? -delta : delta;
+                    if constexpr (DistanceMetric == WorleyMetric::Manhattan)
+                    {
+                        distance += delta;
+                    }
+                    else
+                    {
+                        distance = delta > distance ? delta : distance;
+                    }
+                }
+            }
+            return distance;
+        }
+
+        template <SizeType Dimensions>
+        [[nodiscard]] static constexpr
+        Raw ManhattanScale() noexcept
+        {
+            return Raw(Dimensions == 2 ? 0.707106781186547524 : (Dimensions == 3 ? 0.577350269189625765 : 0.5));
+        }
+
+        // Note(3011): F1 and F2 of a sample, for the Euclidean metric they
+        // are squared. Keeping the two smallest values with min and max
+        // instead of branches avoids a misprediction for every new minimum.
+        template <WorleyMetric DistanceMetric, SizeType Dimensions>
+        [[nodiscard]] static constexpr
+        Array<Float, 2> Closest(const Neighborhood<Dimensions>& neighborhood, const Array<Float, Dimensions>& local) noexcept
+        {
+            Raw f1 = Raw(16);
+            Raw f2 = Raw(16);
+            for (SizeType index = 0; index < Neighborhood<Dimensions>::Count; ++index)
+            {
+                Raw distance = Distance<DistanceMetric>(neighborhood, local, index);
+                Raw larger = distance > f1 ? distance : f1;
+                f2 = larger < f2 ? larger : f2;
+                f1 = distance < f1 ? distance : f1;
+            }
+
+            if constexpr (DistanceMetric == WorleyMetric::Manhattan)
+            {
+                f1 *= ManhattanScale<Dimensions>();
+                f2 *= ManhattanScale<Dimensions>();
+            }
+            return Array<Float, 2>(Float(f1), Float(f2));
+        }
+
+        template <SizeType Dimensions>
+        struct FeatureGradient
+        {
+            Float Value;
+            Array<Float, Dimensions> Gradient;
+        };
+
+        template <SizeType Dimensions>
+        [[nodiscard]] constexpr
+        FeatureGradient<Dimensions> EvaluateWithGradientOne(const Array<Float, Dimensions>& in) const noexcept
+        {
+            Neighborhood<Dimensions> neighborhood;
+            Array<Int, Dimensions> cell;
+            Array<Float, Dimensions> local;
+            for (SizeType axis = 0; axis < Dimensions; ++axis)
+            {
+                cell[axis] = FloorToInt(in[axis]);
+                local[axis] = in[axis] - Cast<Float>(cell[axis]);
+            }
+            MoveTo(neighborhood, cell);
+
+            switch (mMetric)
+            {
+            case WorleyMetric::Manhattan:
+                return CombineWithGradient(ClosestWithGradient<WorleyMetric::Manhattan>(neighborhood, local));
+            case WorleyMetric::Chebyshev:
+                return CombineWithGradient(ClosestWithGradient<WorleyMetric::Chebyshev>(neighborhood, local));
+            default:
+                return CombineWithGradient(ClosestWithGradient<WorleyMetric::Euclidean>(neighborhood, local));
+            }
+        }
+
+        // Note(3011): Same as Closest, but also remembers which feature
+        // points are the closest two, to differentiate their distances:
+        //   Euclidean: the unit vector from the feature point to the sample.
+        //   Manhattan: the signs of that vector, divided by sqrt(D).
+        //   Chebyshev: the sign along the axis with the largest difference.
+        // The gradients do not exist where two feature points are equally
+        // close, there one of them is picked.
+        template <WorleyMetric DistanceMetric, SizeType Dimensions>
+        [[nodiscard]] static constexpr
+        Array<FeatureGradient<Dimensions>, 2> ClosestWithGradient(const Neighborhood<Dimensions>& neighborhood, const Array<Float, Dimensions>& local) noexcept
+        {
+            Array<Raw, 2> distances = Array<Raw, 2>(Raw(16), Raw(16));
+            Array<SizeType, 2> indices;
+            for (SizeType index = 0; index < Neighborhood<Dimensions>::Count; ++index)
+            {
+                Raw distance = Distance<DistanceMetric>(neighborhood, local, index);
+                if (distance < distances[0])
+                {
+                    distances[1] = distances[0];
+                    indices[1] = indices[0];
+                    distances[0] = distance;
+                    indices[0] = index;
+                }
+                else if (distance < distances[1])
+                {
+                    distances[1] = distance;
+                    indices[1] = index;
+                }
+            }
+
+            Array<FeatureGradient<Dimensions>, 2> result;
+            for (SizeType i = 0; i < 2; ++i)
+            {
+                Raw distance = distances[i];
+                if constexpr (DistanceMetric == WorleyMetric::Euclidean)
+                {
+                    distance = ToUnderlying(Sqrt(Float(distance)));
+                }
+                else if constexpr (DistanceMetric == WorleyMetric::Manhattan)
+                {
+                    distance *= ManhattanScale<Dimensions>();
+                }
+                result[i].Value = Float(distance);
+
+                SizeType largest = 0;
+                for (SizeType axis = 0; axis < Dimensions; ++axis)
+                {
+                    Raw delta = Delta(neighborhood, local, indices[i], axis);
+                    Raw sign = delta < Raw(0) ? Raw(1) : (delta > Raw(0) ? Raw(-1) : Raw(0));
+                    if constexpr (DistanceMetric == WorleyMetric::Euclidean)
+                    {
+                        result[i].Gradient[axis] = Float(distance > Raw(0) ? -delta / distance : Raw(0));
+                    }
+                    else if constexpr (DistanceMetric == WorleyMetric::Manhattan)
+                    {
+                        result[i].Gradient[axis] = Float(sign * ManhattanScale<Dimensions>());
+                    }
+                    else
+                    {
+                        Raw magnitude = delta < Raw(0) ? -delta : delta;
+                        Raw largestDelta = Delta(neighborhood, local, indices[i], largest);
+                        largest = magnitude > (largestDelta < Raw(0) ? -largestDelta : largestDelta) ? axis : largest;
+                        result[i].Gradient[axis] = Float(sign);
+                    }
+                }
+
+                if constexpr (DistanceMetric == WorleyMetric::Chebyshev)
+                {
+                    for (SizeType axis = 0; axis < Dimensions; ++axis)
+                    {
+                        result[i].Gradient[axis] = axis == largest ? result[i].Gradient[axis] : Float(0);
+                    }
+                }
+            }
+            return result;
+        }
+
+        [[nodiscard]] constexpr
+        Float Combine(const Array<Float, 2>& closest) const noexcept
+        {
+            Float value = closest[0];
+            if (mFeature == WorleyFeature::F2)
+            {
+                value = closest[1];
+            }
+            else if (mFeature == WorleyFeature::F2MinusF1)
+            {
+                value = closest[1] - closest[0];
+            }
+            return Min(value, Float(1));
+        }
+
+        template <SizeType Dimensions>
+        [[nodiscard]] constexpr
+        FeatureGradient<Dimensions> CombineWithGradient(const Array<FeatureGradient<Dimensions>, 2>& closest) const noexcept
+        {
+            FeatureGradient<Dimensions> result;
+            result.Value = Combine(Array<Float, 2>(closest[0].Value, closest[1].Value));
+            bool clamped = !(result.Value < Float(1));
+            for (SizeType axis = 0; axis < Dimensions; ++axis)
+            {
+                Float gradient = closest[0].Gradient[axis];
+                if (mFeature == WorleyFeature::F2)
+                {
+                    gradient = closest[1].Gradient[axis];
+                }
+                else if (mFeature == WorleyFeature::F2MinusF1)
+                {
+                    gradient = closest[1].Gradient[axis] - closest[0].Gradient[axis];
+                }
+                result.Gradient[axis] = clamped ? Float(0) : gradient;
+            }
+            return result;
+        }
+
+        // Note(3011): Brings the neighborhood to the given cell, reusing the
+        // feature points it already holds when moving one cell along x.
+        template <SizeType Dimensions>
+        constexpr
+        void MoveTo(Neighborhood<Dimensions>& neighborhood, const Array<Int, Dimensions>& cell) const noexcept
+        {
+            bool sameRow = neighborhood.Valid;
+            for (SizeType axis = 1; axis < Dimensions; ++axis)
+            {
+                sameRow = sameRow && cell[axis] == neighborhood.Cell[axis];
+            }
+
+            if (sameRow && cell[0] == neighborhood.Cell[0])
+            {
+                return;
+            }
+
+            bool shift = sameRow && cell[0] == neighborhood.Cell[0] + Int(1);
+            neighborhood.Cell = cell;
+            neighborhood.Valid = true;
+            for (SizeType index = 0; index < Neighborhood<Dimensions>::Count; ++index)
+            {
+                if (shift && index % 3 < 2)
+                {
+                    for (SizeType axis = 0; axis < Dimensions; ++axis)
+                    {
+                        neighborhood.Jitter[axis][index] = neighborhood.Jitter[axis][index + 1];
+                    }
+                }
+                else
+                {
+                    LoadJitter(neighborhood, index);
+                }
+            }
+        }
+
+        // Note(3011): Every coordinate of the feature point gets its own hash.
+        // The axis is hashed first, in front of the lattice coordinates, so
+        // each axis runs the whole permutation chain from a different start.
+        // Hashing it last would only add it before the final lookup, and all
+        // coordinates would follow from the same 8-bit hash of the cell. The
+        // 256 possible values are centered in their bins, so the point is
+        // never exactly on the cell border.
+        template <SizeType Dimensions>
+        constexpr
+        void LoadJitter(Neighborhood<Dimensions>& neighborhood, SizeType index) const noexcept
+        {
+            Array<u8, Dimensions> lattice;
+            for (SizeType axis = 0; axis < Dimensions; ++axis)
+            {
+                Int offset = Trunc<Int>(sCellOffsets<Dimensions>[axis][index]);
+                lattice[axis] = Implementation::LatticeIndex(neighborhood.Cell[axis] + offset);
+            }
+
+            for (SizeType axis = 0; axis < Dimensions; ++axis)
+            {
+                u8 hash = Hash(lattice, Cast<u8>(axis));
+                neighborhood.Jitter[axis][index] = (Cast<Float>(hash) + Float(0.5)) / Float(256);
+            }
+        }
+
+        template <SizeType Dimensions>
+        [[nodiscard]] constexpr
+        u8 Hash(const Array<u8, Dimensions>& lattice, u8 axis) const noexcept
+        {
+            if constexpr (Dimensions == 2)
+            {
+                return mPermutation.Hash(axis, lattice[0], lattice[1]);
+            }
+            else if constexpr (Dimensions == 3)
+            {
+                return mPermutation.Hash(axis, lattice[0], lattice[1], lattice[2]);
+            }
+            else
+            {
+                return mPermutation.Hash(axis, lattice[0], lattice[1], lattice[2], lattice[3]);
+            }
+        }
+
+        Implementation::Permutation mPermutation;
+        WorleyFeature mFeature;
+        WorleyMetric mMetric;
     };
 }
 
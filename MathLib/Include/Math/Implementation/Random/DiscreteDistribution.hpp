@@ -0,0 +1,237 @@
+#ifndef MATHLIB_IMPLEMENTATION_RANDOM_DISCRETE_DISTRIBUTION_HPP
+#define MATHLIB_IMPLEMENTATION_RANDOM_DISCRETE_DISTRIBUTION_HPP
+
+#include "../Base/Concepts.hpp"
+#include "../Functions/BasicFunctions.hpp"
+#include "Utils.hpp"
+
+#include <span>
+#include <vector>
+
+namespace Math
+{
+    // Note(3011): Samples indices proportionally to a set of non-negative
+    // weights, using Vose's variant of Walker's alias method. Building the
+    // table is O(n), sampling is O(1) and uses a single 64-bit draw: the high
+    // 32 bits pick the column (Lemire's method, so it is unbiased), the low
+    // 32 bits decide between the column and its alias. Thresholds are stored
+    // as 32.32 fixed point, so the coin flip is an integer compare.
+    //
+    // If all weights are zero, every index is equally likely. An empty
+    // distribution, default constructed or built from no weights, has no
+    // index to return and always returns Size(), which is 0, without drawing
+    // from the generator. The number of weights has to fit into 32 bits.
+    //
+    // For weights that change a little every frame, update them one by one
+    // with SetWeight and call Rebuild once before sampling again. The alias
+    // table can't be patched in place, so Rebuild still rebuilds the whole
+    // table in O(n), however few weights changed. It reuses all buffers, so
+    // it does not allocate, and does nothing if no weight has changed.
+    // Weight, TotalWeight and Probability see a new weight right away,
+    // sampling only after the next Rebuild.
+    template <Concept::StrongFloatType T>
+    class DiscreteDistribution
+    {
+    public:
+        using ValueType = SizeType;
+        using WeightType = T;
+
+        DiscreteDistribution() = default;
+
+        explicit
+        DiscreteDistribution(std::span<const WeightType> weights)
+        {
+            Rebuild(weights);
+        }
+
+        void Rebuild(std::span<const WeightType> weights)
+        {
+            mWeights.assign(weights.begin(), weights.end());
+            mDirty = true;
+            Rebuild();
+        }
+
+        void Rebuild()
+        {
+            if (!mDirty)
+            {
+                return;
+            }
+            mDirty = false;
+
+            SizeType count = mWeights.size();
+            mTable.resize(ToUnderlying(count));
+            mScaled.resize(ToUnderlying(count));
+            mWork.resize(ToUnderlying(count));
+
+            // Note(3011): SetWeight only adjusts the total by the difference.
+            // It is summed from scratch in f64 here, so repeated SetWeight
+            // calls can't accumulate rounding errors.
+            f64 total = 0;
+            for (const WeightType& weight : mWeights)
+            {
+                total += Cast<f64>(weight);
+            }
+            mTotal = Cast<WeightType>(total);
+
+            f64 scale = (total > f64(0)) ? Cast<f64>(count) / total : f64(0);
+            SizeType smallCount = 0;
+            SizeType largeBegin = count;
+            for (SizeType i = 0; i < count; ++i)
+            {
+                f64 scaled = (total > f64(0)) ? Cast<f64>(mWeights[ToUnderlying(i)]) * scale : f64(1);
+                mScaled[ToUnderlying(i)] = scaled;
+                if (scaled < f64(1))
+                {
+                    mWork[ToUnderlying(smallCount++)] = Cast<u32>(i);
+                }
+                else
+                {
+                    mWork[ToUnderlying(--largeBegin)] = Cast<u32>(i);
+                }
+            }
+
+            // Note(3011): Small indices grow from the front of the work buffer and
+            // large ones from the back. Each step retires one small index, so the
+            // two stacks can never run into each other.
+            while (smallCount > 0 && largeBegin < count)
+            {
+                u32 small = mWork[ToUnderlying(--smallCount)];
+                u32 large = mWork[ToUnderlying(largeBegin++)];
+
+                mTable[ToUnderlying(small)] = {ToThreshold(mScaled[ToUnderlying(small)]), large};
+
+                f64& remaining = mScaled[ToUnderlying(large)];
+                remaining = (remaining + mScaled[ToUnderlying(small)]) - f64(1);
+                if (remaining < f64(1))
+                {
+                    mWork[ToUnderlying(smallCount++)] = large;
+                }
+                else
+                {
+                    mWork[ToUnderlying(--largeBegin)] = large;
+                }
+            }
+
+            // Note(3011): Whatever is left is 1 up to rounding errors.
+            for (SizeType i = largeBegin; i < count; ++i)
+            {
+                u32 index = mWork[ToUnderlying(i)];
+                mTable[ToUnderlying(index)] = {sAlwaysAccept, index};
+            }
+            for (SizeType i = 0; i < smallCount; ++i)
+            {
+                u32 index = mWork[ToUnderlying(i)];
+                mTable[ToUnderlying(index)] = {sAlwaysAccept, index};
+            }
+        }
+
+        void SetWeight(SizeType index, WeightType weight) noexcept
+        {
+            WeightType& current = mWeights[ToUnderlying(index)];
+            if (current != weight)
+            {
+                mTotal += weight - current;
+                current = weight;
+                mDirty = true;
+            }
+        }
+
+        template <Concept::RandomNumberGenerator RNG>
+        [[nodiscard]]
+        ValueType operator()(RNG& rng) const noexcept
+        {
+            constexpr u64 range32 = u64(1) << u64(32);
+
+            u64 count = Cast<u64>(mTable.size());
+            if (count == u64(0))
+            {
+                return Cast<SizeType>(count);
+            }
+
+            u64 bits = GetRandomBits<u64>(rng);
+
+            u64 product = (bits >> u64(32)) * count;
+            u64 low = product & (range32 - 1);
+            if (low < count)
+            {
+                u64 threshold = (range32 - count) % count;
+                while (low < threshold)
+                {
+                    bits = (bits & (range32 - 1)) | (GetRandomBits<u64>(rng) << u64(32));
+                    product = (bits >> u64(32)) * count;
+                    low = product & (range32 - 1);
+                }
+            }
+
+            const Entry& entry = mTable[ToUnderlying(product >> u64(32))];
+            return (Cast<u64>(Cast<u32>(bits)) < entry.Threshold) ? Cast<SizeType>(product >> u64(32)) : Cast<SizeType>(entry.Alias);
+        }
+
+        template <Concept::RandomNumberGenerator RNG>
+        void Fill(std::span<ValueType> values, RNG& rng) const noexcept
+        {
+            for (ValueType& value : values)
+            {
+                value = (*this)(rng);
+            }
+        }
+
+        [[nodiscard]]
+        WeightType Probability(SizeType index) const noexcept
+        {
+            if (mTotal > Cast<WeightType>(0))
+            {
+                return mWeights[ToUnderlying(index)] / mTotal;
+            }
+            return Cast<WeightType>(1) / Cast<WeightType>(mWeights.size());
+        }
+
+        [[nodiscard]]
+        WeightType Weight(SizeType index) const noexcept
+        {
+            return mWeights[ToUnderlying(index)];
+        }
+
+        [[nodiscard]]
+        WeightType TotalWeight() const noexcept
+        {
+            return mTotal;
+        }
+
+        [[nodiscard]]
+        SizeType Size() const noexcept
+        {
+            return mWeights.size();
+        }
+
+        [[nodiscard]]
+        bool Empty() const noexcept
+        {
+            return mWeights.empty();
+        }
+    private:
+        struct Entry
+        {
+            u64 Threshold;
+            u32 Alias;
+        };
+
+        static constexpr u64 sAlwaysAccept = u64(1) << u64(32);
+
+        [[nodiscard]] static
+        u64 ToThreshold(f64 probability) noexcept
+        {
+            return Min(Cast<u64>(probability * f64(4294967296.0)), sAlwaysAccept);
+        }
+
+        std::vector<WeightType> mWeights;
+        std::vector<Entry> mTable;
+        std::vector<f64> mScaled;
+        std::vector<u32> mWork;
+        WeightType mTotal = Cast<WeightType>(0);
+        bool mDirty = false;
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_RANDOM_DISCRETE_DISTRIBUTION_HPP
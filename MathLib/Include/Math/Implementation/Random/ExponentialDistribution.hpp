@@ -0,0 +1,34 @@
+#ifndef MATHLIB_IMPLEMENTATION_RANDOM_EXPONENTIAL_DISTRIBUTION_HPP
+#define MATHLIB_IMPLEMENTATION_RANDOM_EXPONENTIAL_DISTRIBUTION_HPP
+
+#include "Ziggurat.hpp"
+
+namespace Math
+{
+    // Note(3011): The offset shifts the whole distribution, which is mostly
+    // there to match the two parameter form of the other distributions.
+
+    template <Concept::StrongFloatType T>
+    class ExponentialDistribution
+    {
+    public:
+        using ValueType = T;
+
+        [[nodiscard]] constexpr
+        ExponentialDistribution(ValueType rate = Cast<ValueType>(1), ValueType offset = Cast<ValueType>(0)) noexcept
+            : mInvRate(Cast<ValueType>(1) / rate), mOffset(offset)
+        {}
+
+        template <Concept::RandomNumberGenerator RNG>
+        [[nodiscard]] constexpr
+        ValueType operator()(RNG& rng) const noexcept
+        {
+            return mOffset + mInvRate * Cast<ValueType>(Implementation::ExponentialZiggurat::Sample(rng));
+        }
+    private:
+        ValueType mInvRate;
+        ValueType mOffset;
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_RANDOM_EXPONENTIAL_DISTRIBUTION_HPP
@@ -0,0 +1,74 @@
+#ifndef MATHLIB_IMPLEMENTATION_RANDOM_GAMMA_DISTRIBUTION_HPP
+#define MATHLIB_IMPLEMENTATION_RANDOM_GAMMA_DISTRIBUTION_HPP
+
+#include "Ziggurat.hpp"
+
+namespace Math
+{
+    // Note(3011):
+    // Uses Marsaglia and Tsang, "A Simple Method for Generating Gamma Variables"
+    // (2000), on top of the normal ziggurat. Shapes below one are boosted to
+    // shape + 1 and scaled back by U^(1 / shape).
+
+    template <Concept::StrongFloatType T>
+    class GammaDistribution
+    {
+    public:
+        using ValueType = T;
+
+        [[nodiscard]] constexpr
+        GammaDistribution(ValueType shape = Cast<ValueType>(1), ValueType scale = Cast<ValueType>(1)) noexcept
+            : mScale(Cast<f64>(scale))
+        {
+            f64 boostedShape = Cast<f64>(shape);
+            if (shape < Cast<ValueType>(1))
+            {
+                mInvShape = f64(1) / Cast<f64>(shape);
+                boostedShape += f64(1);
+            }
+
+            mD = boostedShape - f64(1) / f64(3);
+            mC = f64(1) / Sqrt(f64(9) * mD);
+        }
+
+        template <Concept::RandomNumberGenerator RNG>
+        [[nodiscard]] constexpr
+        ValueType operator()(RNG& rng) const noexcept
+        {
+            f64 result = f64(0);
+            while (true)
+            {
+                f64 x = Implementation::NormalZiggurat::Sample(rng);
+                f64 v = f64(1) + mC * x;
+                if (v <= f64(0))
+                {
+                    continue;
+                }
+
+                v = Cubed(v);
+                f64 u = f64(1) - UniformUnitDistribution<f64>()(rng);
+                f64 x2 = Squared(x);
+                if (u < f64(1) - f64(0.0331) * Squared(x2)
+                 || Log(u) < f64(0.5) * x2 + mD * (f64(1) - v + Log(v)))
+                {
+                    result = mD * v;
+                    break;
+                }
+            }
+
+            if (mInvShape > f64(0))
+            {
+                result *= Pow(f64(1) - UniformUnitDistribution<f64>()(rng), mInvShape);
+            }
+
+            return Cast<ValueType>(result * mScale);
+        }
+    private:
+        f64 mScale;
+        f64 mInvShape = f64(0);
+        f64 mD = f64(0);
+        f64 mC = f64(0);
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_RANDOM_GAMMA_DISTRIBUTION_HPP
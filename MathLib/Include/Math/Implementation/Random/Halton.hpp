@@ -0,0 +1,201 @@
+#ifndef MATHLIB_IMPLEMENTATION_RANDOM_HALTON_HPP
+#define MATHLIB_IMPLEMENTATION_RANDOM_HALTON_HPP
+
+#include "../Base/Array.hpp"
+#include "../Base/Concepts.hpp"
+#include "../Functions/BasicFunctions.hpp"
+#include "Shuffle.hpp"
+#include "Utils.hpp"
+
+#include <span>
+
+namespace Math
+{
+    namespace Implementation
+    {
+        struct HaltonBase
+        {
+            u32 Base;
+            // Note(3011): Only the lowest Digits digits of the index are used,
+            // chosen so that Base^Digits still fits into the f64 mantissa. This
+            // keeps the radical inverse an exact integer divided by Scale.
+            SizeType Digits;
+            u64 Scale;
+            f64 InvScale;
+            // Note(3011): Offset of this base's digit permutation.
+            SizeType PermutationOffset;
+        };
+
+        inline constexpr SizeType HaltonDimensions = 32;
+
+        using HaltonBases = Array<HaltonBase, HaltonDimensions>;
+
+        [[nodiscard]] constexpr
+        HaltonBases MakeHaltonBases() noexcept
+        {
+            HaltonBases bases;
+            u32 candidate = 2;
+            SizeType offset = 0;
+            for (SizeType dimension = 0; dimension < HaltonDimensions; ++candidate)
+            {
+                bool isPrime = true;
+                for (u32 divisor = 2; divisor * divisor <= candidate; ++divisor)
+                {
+                    if (candidate % divisor == u32(0))
+                    {
+                        isPrime = false;
+                        break;
+                    }
+                }
+                if (!isPrime)
+                {
+                    continue;
+                }
+
+                HaltonBase& base = bases[dimension++];
+                base.Base = candidate;
+                base.Digits = 0;
+                base.Scale = 1;
+                while (base.Scale * Cast<u64>(candidate) <= (u64(1) << u64(53)))
+                {
+                    base.Scale *= Cast<u64>(candidate);
+                    ++base.Digits;
+                }
+                base.InvScale = f64(1) / Cast<f64>(base.Scale);
+                base.PermutationOffset = offset;
+                offset += Cast<SizeType>(candidate);
+            }
+            return bases;
+        }
+
+        inline constexpr HaltonBases sHaltonBases = MakeHaltonBases();
+        inline constexpr SizeType HaltonPermutationSize =
+            sHaltonBases[HaltonDimensions - 1].PermutationOffset + Cast<SizeType>(sHaltonBases[HaltonDimensions - 1].Base);
+    }
+
+    // Note(3011): Dimension d uses the d-th prime as its base. The seeded
+    // sequence applies a random permutation to the digits of each base
+    // (random digit scrambling), which breaks up the correlation between
+    // the higher dimensions that makes the plain Halton sequence unusable
+    // there. The permutation is applied to all Digits digits, including the
+    // leading zeros of small indices.
+    template <Concept::StrongFloatType T>
+    class HaltonSequence
+    {
+    public:
+        using ValueType = T;
+
+        static constexpr SizeType Dimensions = Implementation::HaltonDimensions;
+
+        [[nodiscard]] constexpr
+        HaltonSequence() noexcept
+            : mPermutations()
+        {
+            for (SizeType dimension = 0; dimension < Dimensions; ++dimension)
+            {
+                const Implementation::HaltonBase& base = Implementation::sHaltonBases[dimension];
+                for (u32 digit = 0; digit < base.Base; ++digit)
+                {
+                    mPermutations[base.PermutationOffset + Cast<SizeType>(digit)] = Cast<u16>(digit);
+                }
+            }
+        }
+
+        template <Concept::RandomNumberGenerator RNG>
+        [[nodiscard]] constexpr explicit
+        HaltonSequence(RNG& rng) noexcept
+            : HaltonSequence()
+        {
+            for (SizeType dimension = 0; dimension < Dimensions; ++dimension)
+            {
+                const Implementation::HaltonBase& base = Implementation::sHaltonBases[dimension];
+                Shuffle(std::span<u16>(mPermutations.Data() + ToUnderlying(base.PermutationOffset), ToUnderlying(base.Base)), rng);
+            }
+        }
+
+        [[nodiscard]] constexpr
+        ValueType Sample(SizeType index, SizeType dimension) const noexcept
+        {
+            const Implementation::HaltonBase& base = Implementation::sHaltonBases[dimension];
+            const u16* permutation = mPermutations.Data() + ToUnderlying(base.PermutationOffset);
+
+            u64 digits = Cast<u64>(index);
+            u64 radix = Cast<u64>(base.Base);
+            u64 reversed = 0;
+            for (SizeType i = 0; i < base.Digits; ++i)
+            {
+                u64 next = digits / radix;
+                reversed = reversed * radix + Cast<u64>(permutation[ToUnderlying(digits - next * radix)]);
+                digits = next;
+            }
+            return ToValue(reversed, base);
+        }
+
+        // Note(3011): Writes samples firstIndex, firstIndex + 1, ... of a single
+        // dimension. The digits are kept around and incremented with carries,
+        // so a sample usually only costs a single digit update.
+        constexpr
+        void Fill(SizeType firstIndex, SizeType dimension, std::span<ValueType> values) const noexcept
+        {
+            if (values.empty())
+            {
+                return;
+            }
+
+            const Implementation::HaltonBase& base = Implementation::sHaltonBases[dimension];
+            const u16* permutation = mPermutations.Data() + ToUnderlying(base.PermutationOffset);
+            u64 radix = Cast<u64>(base.Base);
+
+            // Note(3011): weights[i] is the weight of digit i in the reversed
+            // integer, so changing that digit is a single multiply-add.
+            Array<u32, 64> digits;
+            Array<u64, 64> weights;
+            u64 remaining = Cast<u64>(firstIndex);
+            u64 weight = base.Scale;
+            for (SizeType i = 0; i < base.Digits; ++i)
+            {
+                weight /= radix;
+                u64 next = remaining / radix;
+                digits[i] = Cast<u32>(remaining - next * radix);
+                weights[i] = weight;
+                remaining = next;
+            }
+
+            values[0] = Sample(firstIndex, dimension);
+            u64 reversed = 0;
+            for (SizeType i = 0; i < base.Digits; ++i)
+            {
+                reversed += Cast<u64>(permutation[ToUnderlying(digits[i])]) * weights[i];
+            }
+
+            for (SizeType n = 1; n < values.size(); ++n)
+            {
+                for (SizeType i = 0; i < base.Digits; ++i)
+                {
+                    u32 digit = digits[i];
+                    u32 incremented = (digit + 1 == base.Base) ? u32(0) : digit + 1;
+                    reversed -= Cast<u64>(permutation[ToUnderlying(digit)]) * weights[i];
+                    reversed += Cast<u64>(permutation[ToUnderlying(incremented)]) * weights[i];
+                    digits[i] = incremented;
+                    if (incremented != u32(0))
+                    {
+                        break;
+                    }
+                }
+                values[ToUnderlying(n)] = ToValue(reversed, base);
+            }
+        }
+    private:
+        [[nodiscard]] static constexpr
+        ValueType ToValue(u64 reversed, const Implementation::HaltonBase& base) noexcept
+        {
+            // Note(3011): Rounding to f32 could produce exactly 1.
+            constexpr ValueType oneMinusEpsilon = Cast<ValueType>(1) - ValueType::Epsilon() / Cast<ValueType>(2);
+            return Min(Cast<ValueType>(Cast<f64>(reversed) * base.InvScale), oneMinusEpsilon);
+        }
+
+        Array<u16, Implementation::HaltonPermutationSize> mPermutations;
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_RANDOM_HALTON_HPP
@@ -0,0 +1,31 @@
+#ifndef MATHLIB_IMPLEMENTATION_RANDOM_NORMAL_DISTRIBUTION_HPP
+#define MATHLIB_IMPLEMENTATION_RANDOM_NORMAL_DISTRIBUTION_HPP
+
+#include "Ziggurat.hpp"
+
+namespace Math
+{
+    template <Concept::StrongFloatType T>
+    class NormalDistribution
+    {
+    public:
+        using ValueType = T;
+
+        [[nodiscard]] constexpr
+        NormalDistribution(ValueType mean = Cast<ValueType>(0), ValueType stddev = Cast<ValueType>(1)) noexcept
+            : mMean(mean), mStddev(stddev)
+        {}
+
+        template <Concept::RandomNumberGenerator RNG>
+        [[nodiscard]] constexpr
+        ValueType operator()(RNG& rng) const noexcept
+        {
+            return mMean + mStddev * Cast<ValueType>(Implementation::NormalZiggurat::Sample(rng));
+        }
+    private:
+        ValueType mMean;
+        ValueType mStddev;
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_RANDOM_NORMAL_DISTRIBUTION_HPP
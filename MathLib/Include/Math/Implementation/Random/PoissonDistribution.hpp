@@ -2,12 +2,17 @@
 #define MATHLIB_IMPLEMENTATION_RANDOM_POISSON_DISTRIBUTION_HPP
 
 #include "UniformDistribution.hpp"
+#include "../Functions/FloatUtils.hpp"
+#include "../Functions/Log.hpp"
 
 namespace Math
 {
     // Note(3011):
-    // Works fine for mean values up to ~700 (doubles/f64) or ~100 (floats/f32).
-    // This is not ideal, but it should work fine for most purposes.
+    // Small means are sampled by walking the CDF, which takes O(mean) steps.
+    // Means of at least sPTRSThreshold use Hörmann's transformed rejection with
+    // squeeze (PTRS, "The transformed rejection method for generating Poisson
+    // random variables", 1993), which takes O(1) expected time. All constants
+    // that depend only on the mean are computed once in the constructor.
 
     template <Concept::StrongIntegerType T>
     class PoissonDistribution
@@ -19,16 +24,40 @@ namespace Math
         [[nodiscard]] constexpr
         PoissonDistribution(MeanType mean = Cast<MeanType>(0))
             : mUniform(Cast<MeanType>(0), Cast<MeanType>(1)), mMean(mean)
-        {}
+        {
+            if (mMean < sPTRSThreshold)
+            {
+                mExpMinusMean = Exp(-mMean);
+                return;
+            }
+
+            mB = Cast<MeanType>(0.931) + Cast<MeanType>(2.53) * Sqrt(mMean);
+            mA = Cast<MeanType>(-0.059) + Cast<MeanType>(0.02483) * mB;
+            mLogInvAlpha = Log(Cast<MeanType>(1.1239) + Cast<MeanType>(1.1328) / (mB - Cast<MeanType>(3.4)));
+            mVr = Cast<MeanType>(0.9277) - Cast<MeanType>(3.6224) / (mB - Cast<MeanType>(2));
+            mLogMean = Log(mMean);
+        }
 
         template <Concept::RandomNumberGenerator RNG>
         [[nodiscard]] constexpr
         ValueType operator()(RNG& rng) const noexcept
+        {
+            if (mMean < sPTRSThreshold)
+            {
+                return SampleInversion(rng);
+            }
+
+            return SamplePTRS(rng);
+        }
+    private:
+        template <Concept::RandomNumberGenerator RNG>
+        [[nodiscard]] constexpr
+        ValueType SampleInversion(RNG& rng) const noexcept
         {
             MeanType uniformSample = mUniform(rng);
 
             ValueType i = 0;
-            MeanType p = Exp(-mMean);
+            MeanType p = mExpMinusMean;
             MeanType cdf = p;
             while (uniformSample >= cdf)
             {
@@ -39,9 +68,59 @@ namespace Math
 
             return i;
         }
-    private:
+
+        template <Concept::RandomNumberGenerator RNG>
+        [[nodiscard]] constexpr
+        ValueType SamplePTRS(RNG& rng) const noexcept
+        {
+            using Int = SignedIntegerSelector<sizeof(MeanType)>;
+            constexpr MeanType half = Cast<MeanType>(0.5);
+
+            while (true)
+            {
+                MeanType u = UniformUnitDistribution<MeanType>()(rng) - half;
+                MeanType v = UniformUnitDistribution<MeanType>()(rng);
+                MeanType us = half - Abs(u);
+
+                // Note(3011): This rejection is hoisted above the computation of k
+                // (the fast acceptance below needs us >= 0.07 anyway), so that
+                // us == 0 never reaches the division.
+                if (us < Cast<MeanType>(0.013) && v >= us)
+                {
+                    continue;
+                }
+
+                Int k = Floor<Int>((Cast<MeanType>(2) * mA / us + mB) * u + mMean + Cast<MeanType>(0.43));
+                if (us >= Cast<MeanType>(0.07) && v <= mVr)
+                {
+                    return Cast<ValueType>(k);
+                }
+
+                if (k < Int(0))
+                {
+                    continue;
+                }
+
+                MeanType kf = Cast<MeanType>(k);
+                MeanType lhs = Log(v) + mLogInvAlpha - Log(mA / Squared(us) + mB);
+                MeanType rhs = -mMean + kf * mLogMean - LogGamma(kf + Cast<MeanType>(1));
+                if (lhs <= rhs)
+                {
+                    return Cast<ValueType>(k);
+                }
+            }
+        }
+
+        static constexpr MeanType sPTRSThreshold = Cast<MeanType>(10);
+
         UniformDistribution<MeanType> mUniform;
         MeanType mMean;
+        MeanType mExpMinusMean = Cast<MeanType>(0);
+        MeanType mA = Cast<MeanType>(0);
+        MeanType mB = Cast<MeanType>(0);
+        MeanType mLogInvAlpha = Cast<MeanType>(0);
+        MeanType mVr = Cast<MeanType>(0);
+        MeanType mLogMean = Cast<MeanType>(0);
     };
 }
 
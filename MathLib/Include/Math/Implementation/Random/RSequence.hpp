@@ -0,0 +1,82 @@
+#ifndef MATHLIB_IMPLEMENTATION_RANDOM_R_SEQUENCE_HPP
+#define MATHLIB_IMPLEMENTATION_RANDOM_R_SEQUENCE_HPP
+
+// Note(3011):
+// Martin Roberts' additive recurrence, see "The Unreasonable Effectiveness of
+// Quasirandom Sequences" (2018). Dimension j of an s dimensional sequence
+// steps by phi^-(j + 1), where phi is the positive root of x^(s + 1) = x + 1.
+
+#include "../Base/Array.hpp"
+#include "../Base/Concepts.hpp"
+#include "../Functions/BasicFunctions.hpp"
+#include "Utils.hpp"
+
+#include <span>
+
+namespace Math
+{
+    // Note(3011): The steps are kept as 0.64 fixed point numbers, which makes
+    // the modulo free and the samples exact for any index. Unlike Sobol and
+    // Halton, the whole sequence depends on the number of dimensions, so it
+    // has to be given up front. The offset shifts all dimensions (Cranley-
+    // Patterson rotation) and can be used to decorrelate pixels.
+    template <Concept::StrongFloatType T>
+    class RSequence
+    {
+    public:
+        using ValueType = T;
+
+        static constexpr SizeType MaxDimensions = 32;
+
+        [[nodiscard]] constexpr explicit
+        RSequence(SizeType dimensions = 2, ValueType offset = Cast<ValueType>(0.5)) noexcept
+            : mSteps(), mOffset(ToFixedPoint(Cast<f64>(offset)))
+        {
+            f64 exponent = Cast<f64>(dimensions + 1);
+            f64 phi = f64(2);
+            for (i32 i = 0; i < 64; ++i)
+            {
+                // Note(3011): Newton's method on x^(s + 1) - x - 1.
+                f64 power = Pow(phi, exponent);
+                phi -= (power - phi - f64(1)) / (exponent * power / phi - f64(1));
+            }
+
+            f64 step = f64(1);
+            for (SizeType dimension = 0; dimension < dimensions && dimension < MaxDimensions; ++dimension)
+            {
+                step /= phi;
+                mSteps[dimension] = ToFixedPoint(step);
+            }
+        }
+
+        [[nodiscard]] constexpr
+        ValueType Sample(SizeType index, SizeType dimension) const noexcept
+        {
+            return Implementation::UnitFromBits<ValueType>(mOffset + Cast<u64>(index) * mSteps[dimension]);
+        }
+
+        constexpr
+        void Fill(SizeType firstIndex, SizeType dimension, std::span<ValueType> values) const noexcept
+        {
+            u64 step = mSteps[dimension];
+            u64 bits = mOffset + Cast<u64>(firstIndex) * step;
+            for (ValueType& value : values)
+            {
+                value = Implementation::UnitFromBits<ValueType>(bits);
+                bits += step;
+            }
+        }
+    private:
+        [[nodiscard]] static constexpr
+        u64 ToFixedPoint(f64 value) noexcept
+        {
+            value -= Floor(value);
+            return Cast<u64>(value * f64(18446744073709551616.0));
+        }
+
+        Array<u64, MaxDimensions> mSteps;
+        u64 mOffset;
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_RANDOM_R_SEQUENCE_HPP
@@ -0,0 +1,147 @@
+#ifndef MATHLIB_IMPLEMENTATION_RANDOM_SHUFFLE_HPP
+#define MATHLIB_IMPLEMENTATION_RANDOM_SHUFFLE_HPP
+
+#include "../Base/Concepts.hpp"
+#include "../Functions/IntUtils.hpp"
+#include "Utils.hpp"
+
+#include <span>
+
+namespace Math
+{
+    namespace Implementation
+    {
+        // Note(3011): Generates unbiased integers in [0, bound) using Lemire's
+        // nearly divisionless method. The random bits are consumed 32 at a time,
+        // so a 64-bit generator produces two bounded values per call, which
+        // halves the number of RNG invocations in the common case. Bounds above
+        // 2^32 fall back to bitmask rejection, which needs no wide multiply.
+        template <Concept::RandomNumberGenerator RNG>
+        class BoundedRandom final
+        {
+        public:
+            [[nodiscard]] constexpr explicit
+            BoundedRandom(RNG& rng) noexcept
+                : mRng(rng)
+            {}
+
+            [[nodiscard]] constexpr
+            u64 operator()(u64 bound) noexcept
+            {
+                constexpr u64 range32 = u64(1) << u64(32);
+
+                if (bound <= range32)
+                {
+                    u64 product = Cast<u64>(Next32()) * bound;
+                    u64 low = product & (range32 - 1);
+                    if (low < bound)
+                    {
+                        u64 threshold = (range32 - bound) % bound;
+                        while (low < threshold)
+                        {
+                            product = Cast<u64>(Next32()) * bound;
+                            low = product & (range32 - 1);
+                        }
+                    }
+                    return product >> u64(32);
+                }
+
+                u64 mask = u64::Max() >> Cast<u64>(CountLeadingZeros(ToUnderlying(bound - 1)));
+                u64 result = GetRandomBits<u64>(mRng) & mask;
+                while (result >= bound)
+                {
+                    result = GetRandomBits<u64>(mRng) & mask;
+                }
+                return result;
+            }
+        private:
+            [[nodiscard]] constexpr
+            u32 Next32() noexcept
+            {
+                if constexpr (sizeof(typename RNG::ValueType) == 8)
+                {
+                    if (mBuffered)
+                    {
+                        mBuffered = false;
+                        return mBuffer;
+                    }
+
+                    u64 bits = GetRandomBits<u64>(mRng);
+                    mBuffer = Cast<u32>(bits);
+                    mBuffered = true;
+                    return Cast<u32>(bits >> u64(32));
+                }
+                else
+                {
+                    return GetRandomBits<u32>(mRng);
+                }
+            }
+
+            RNG& mRng;
+            u32 mBuffer = 0;
+            bool mBuffered = false;
+        };
+    }
+
+    template <typename T, Concept::RandomNumberGenerator RNG>
+    constexpr
+    void Shuffle(std::span<T> values, RNG& rng) noexcept
+    {
+        Implementation::BoundedRandom<RNG> bounded(rng);
+        for (SizeType i = values.size(); i > 1; --i)
+        {
+            SizeType j = Cast<SizeType>(bounded(Cast<u64>(i)));
+            Swap(values[ToUnderlying(i - 1)], values[ToUnderlying(j)]);
+        }
+    }
+
+    // Note(3011): Writes Min(result.size(), n) distinct indices from [0, n) to
+    // the front of result and returns how many were written, every subset of
+    // that size being equally likely. A span longer than n cannot be filled,
+    // its tail is left untouched. The order of the indices is unspecified.
+    // Floyd's algorithm is used when the sample is small compared to the
+    // population (the membership test is a linear scan), otherwise the
+    // indices are produced in ascending order by selection sampling.
+    template <Concept::RandomNumberGenerator RNG>
+    constexpr
+    SizeType SampleWithoutReplacement(std::span<SizeType> result, SizeType n, RNG& rng) noexcept
+    {
+        SizeType k = result.size();
+        if (k > n)
+        {
+            k = n;
+        }
+
+        Implementation::BoundedRandom<RNG> bounded(rng);
+        if (k * k <= n)
+        {
+            SizeType count = 0;
+            for (SizeType i = n - k; i < n; ++i)
+            {
+                SizeType candidate = Cast<SizeType>(bounded(Cast<u64>(i + 1)));
+                for (SizeType j = 0; j < count; ++j)
+                {
+                    if (result[ToUnderlying(j)] == candidate)
+                    {
+                        candidate = i;
+                        break;
+                    }
+                }
+                result[ToUnderlying(count++)] = candidate;
+            }
+            return k;
+        }
+
+        SizeType selected = 0;
+        for (SizeType i = 0; i < n && selected < k; ++i)
+        {
+            if (Cast<SizeType>(bounded(Cast<u64>(n - i))) < k - selected)
+            {
+                result[ToUnderlying(selected++)] = i;
+            }
+        }
+        return k;
+    }
+}
+
+#endif //MATHLIB_IMPLEMENTATION_RANDOM_SHUFFLE_HPP
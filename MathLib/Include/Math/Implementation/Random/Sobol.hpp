@@ -0,0 +1,218 @@
+#ifndef MATHLIB_IMPLEMENTATION_RANDOM_SOBOL_HPP
+#define MATHLIB_IMPLEMENTATION_RANDOM_SOBOL_HPP
+
+// Note(3011):
+// The direction numbers are the first entries of Joe and Kuo's
+// "new-joe-kuo-6.21201" set, see https://web.maths.unsw.edu.au/~fkuo/sobol/
+// The first dimension is the van der Corput sequence.
+
+#include "../Base/Array.hpp"
+#include "../Base/Concepts.hpp"
+#include "../Functions/IntUtils.hpp"
+#include "Splitmix.hpp"
+#include "Utils.hpp"
+
+#include <span>
+
+namespace Math
+{
+    // Note(3011): Hash based nested uniform (Owen) scrambling of a base 2 value,
+    // following Burley, "Practical Hash-based Owen Scrambling" (2020). Every bit
+    // is flipped depending on a hash of the bits above it, so the stratification
+    // of a (t, m, s)-net survives the scrambling.
+    [[nodiscard]] constexpr
+    u32 OwenScramble(u32 value, u32 seed) noexcept
+    {
+        value = ReverseBits(value);
+        value += seed;
+        value ^= value * 0x6c50b47cu;
+        value ^= value * 0xb82f1e52u;
+        value ^= value * 0xc7afe638u;
+        value ^= value * 0x8d22f6e6u;
+        return ReverseBits(value);
+    }
+
+    namespace Implementation
+    {
+        struct SobolPolynomial
+        {
+            u32 Degree;
+            u32 Coefficients;
+            u32 Initial[7];
+        };
+
+        inline constexpr Array<SobolPolynomial, 20> sSobolPolynomials = {
+            SobolPolynomial{1,  0, {1}},
+            SobolPolynomial{2,  1, {1, 3}},
+            SobolPolynomial{3,  1, {1, 3, 1}},
+            SobolPolynomial{3,  2, {1, 1, 1}},
+            SobolPolynomial{4,  1, {1, 1, 3, 3}},
+            SobolPolynomial{4,  4, {1, 3, 5, 13}},
+            SobolPolynomial{5,  2, {1, 1, 5, 5, 17}},
+            SobolPolynomial{5,  4, {1, 1, 5, 5, 5}},
+            SobolPolynomial{5,  7, {1, 1, 7, 11, 19}},
+            SobolPolynomial{5, 11, {1, 1, 5, 1, 1}},
+            SobolPolynomial{5, 13, {1, 1, 1, 3, 11}},
+            SobolPolynomial{5, 14, {1, 3, 5, 5, 31}},
+            SobolPolynomial{6,  1, {1, 3, 3, 9, 7, 49}},
+            SobolPolynomial{6, 13, {1, 1, 1, 15, 21, 21}},
+            SobolPolynomial{6, 16, {1, 3, 1, 13, 27, 49}},
+            SobolPolynomial{6, 19, {1, 1, 1, 15, 7, 5}},
+            SobolPolynomial{6, 22, {1, 3, 1, 15, 13, 25}},
+            SobolPolynomial{6, 25, {1, 1, 5, 5, 19, 61}},
+            SobolPolynomial{7,  1, {1, 3, 7, 11, 23, 15, 103}},
+            SobolPolynomial{7,  4, {1, 3, 7, 13, 13, 15, 69}},
+        };
+
+        inline constexpr SizeType SobolDimensions = sSobolPolynomials.Size + 1;
+
+        using SobolMatrices = Array<Array<u32, 32>, SobolDimensions>;
+
+        [[nodiscard]] constexpr
+        SobolMatrices MakeSobolMatrices() noexcept
+        {
+            SobolMatrices matrices;
+            for (SizeType bit = 0; bit < 32; ++bit)
+            {
+                matrices[0][bit] = u32(1) << (SizeType(31) - bit);
+            }
+
+            for (SizeType dimension = 1; dimension < SobolDimensions; ++dimension)
+            {
+                const SobolPolynomial& polynomial = sSobolPolynomials[dimension - 1];
+                Array<u32, 32>& v = matrices[dimension];
+                SizeType degree = Cast<SizeType>(polynomial.Degree);
+
+                for (SizeType bit = 0; bit < degree; ++bit)
+                {
+                    v[bit] = polynomial.Initial[ToUnderlying(bit)] << (SizeType(31) - bit);
+                }
+                for (SizeType bit = degree; bit < 32; ++bit)
+                {
+                    u32 value = v[bit - degree] ^ (v[bit - degree] >> degree);
+                    for (SizeType k = 1; k < degree; ++k)
+                    {
+                        if (ToUnderlying((polynomial.Coefficients >> (degree - SizeType(1) - k)) & u32(1)))
+                        {
+                            value ^= v[bit - k];
+                        }
+                    }
+                    v[bit] = value;
+                }
+            }
+            return matrices;
+        }
+
+        // Note(3011): Going from index i - 1 to i flips the lowest
+        // CountTrailingZeros(i) + 1 bits, so the sample changes by the xor of
+        // the same number of direction numbers. These are precomputed here.
+        [[nodiscard]] constexpr
+        SobolMatrices MakeSobolIncrements(const SobolMatrices& matrices) noexcept
+        {
+            SobolMatrices increments;
+            for (SizeType dimension = 0; dimension < SobolDimensions; ++dimension)
+            {
+                u32 value = 0;
+                for (SizeType bit = 0; bit < 32; ++bit)
+                {
+                    value ^= matrices[dimension][bit];
+                    increments[dimension][bit] = value;
+                }
+            }
+            return increments;
+        }
+
+        inline constexpr SobolMatrices sSobolMatrices = MakeSobolMatrices();
+        inline constexpr SobolMatrices sSobolIncrements = MakeSobolIncrements(sSobolMatrices);
+    }
+
+    // Note(3011): Indices have to be below 2^32 and dimensions below Dimensions.
+    // A seeded sequence is Owen scrambled with an independent seed per
+    // dimension, which keeps the net properties and removes the structured
+    // artifacts of the plain sequence. It also makes the estimate unbiased
+    // when averaged over seeds.
+    template <Concept::StrongFloatType T>
+    class SobolSequence
+    {
+    public:
+        using ValueType = T;
+
+        static constexpr SizeType Dimensions = Implementation::SobolDimensions;
+
+        [[nodiscard]] constexpr
+        SobolSequence() noexcept
+            : mSeeds(), mScrambled(false)
+        {}
+
+        [[nodiscard]] constexpr explicit
+        SobolSequence(u32 seed) noexcept
+            : mSeeds(), mScrambled(true)
+        {
+            Implementation::Splitmix32 splitMix(seed);
+            for (SizeType i = 0; i < Dimensions; ++i)
+            {
+                mSeeds[i] = splitMix();
+            }
+        }
+
+        [[nodiscard]] static constexpr
+        u32 SampleBits(u32 index, SizeType dimension) noexcept
+        {
+            const Array<u32, 32>& matrix = Implementation::sSobolMatrices[dimension];
+
+            u32 result = 0;
+            for (SizeType bit = 0; index != u32(0); ++bit, index >>= SizeType(1))
+            {
+                if (ToUnderlying(index & u32(1)))
+                {
+                    result ^= matrix[bit];
+                }
+            }
+            return result;
+        }
+
+        [[nodiscard]] constexpr
+        ValueType Sample(SizeType index, SizeType dimension) const noexcept
+        {
+            return ToValue(SampleBits(Cast<u32>(index), dimension), dimension);
+        }
+
+        // Note(3011): Writes samples firstIndex, firstIndex + 1, ... of a single
+        // dimension. Consecutive samples only differ by one precomputed xor.
+        constexpr
+        void Fill(SizeType firstIndex, SizeType dimension, std::span<ValueType> values) const noexcept
+        {
+            if (values.empty())
+            {
+                return;
+            }
+
+            const Array<u32, 32>& increments = Implementation::sSobolIncrements[dimension];
+
+            u32 index = Cast<u32>(firstIndex);
+            u32 bits = SampleBits(index, dimension);
+            values[0] = ToValue(bits, dimension);
+            for (SizeType i = 1; i < values.size(); ++i)
+            {
+                ++index;
+                bits ^= increments[Cast<SizeType>(CountTrailingZeros(ToUnderlying(index)))];
+                values[ToUnderlying(i)] = ToValue(bits, dimension);
+            }
+        }
+    private:
+        [[nodiscard]] constexpr
+        ValueType ToValue(u32 bits, SizeType dimension) const noexcept
+        {
+            if (mScrambled)
+            {
+                bits = OwenScramble(bits, mSeeds[dimension]);
+            }
+            return Implementation::UnitFromBits<ValueType>(bits);
+        }
+
+        Array<u32, Dimensions> mSeeds;
+        bool mScrambled;
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_RANDOM_SOBOL_HPP
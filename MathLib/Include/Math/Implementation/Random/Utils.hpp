@@ -28,6 +28,30 @@ namespace Math
             return result;
         }
     }
+
+    namespace Implementation
+    {
+        // Note(3011): Maps an integer onto [0, 1), keeping as many of its high
+        // bits as the mantissa can hold.
+        template <Concept::StrongFloatType T, Concept::StrongType Bits>
+            requires Concept::UnsignedIntegralType<Bits>
+        [[nodiscard]] constexpr
+        T UnitFromBits(Bits bits) noexcept
+        {
+            if constexpr (sizeof(T) == 4)
+            {
+                return Cast<T>(bits >> SizeType(sizeof(Bits) * 8 - 24)) * 0x1.0p-24f;
+            }
+            else if constexpr (sizeof(Bits) == 4)
+            {
+                return Cast<T>(bits) * 0x1.0p-32;
+            }
+            else
+            {
+                return Cast<T>(bits >> SizeType(11)) * 0x1.0p-53;
+            }
+        }
+    }
 }
 
 #endif //MATHLIB_IMPLEMENTATION_RANDOM_UTILS_HPP
@@ -0,0 +1,282 @@
+#ifndef MATHLIB_IMPLEMENTATION_RANDOM_ZIGGURAT_HPP
+#define MATHLIB_IMPLEMENTATION_RANDOM_ZIGGURAT_HPP
+
+// Note(3011):
+// The tables follow Marsaglia and Tsang, "The Ziggurat Method for Generating
+// Random Variables" (2000). Unlike the original, the layer index and the
+// candidate value come from disjoint bits of a single 64-bit draw, which
+// avoids the correlation pointed out by Doornik (2005). The candidate has
+// 32 bits of resolution within its layer, regardless of the output type.
+
+#include "../Base/Array.hpp"
+#include "../Functions/BasicFunctions.hpp"
+#include "../Functions/FloatUtils.hpp"
+#include "../Functions/Log.hpp"
+#include "UniformDistribution.hpp"
+#include "Utils.hpp"
+
+namespace Math::Implementation
+{
+    // Note(3011): std::exp and friends are not constexpr yet, so the tables are
+    // generated with these. They are only meant for compile time evaluation.
+
+    [[nodiscard]] constexpr
+    f64 ConstexprExp(f64 x) noexcept
+    {
+        constexpr f64 ln2 = 0.69314718055994530942;
+
+        if (x < f64(-745))
+        {
+            return f64(0);
+        }
+
+        i64 k = Floor<i64>(x / ln2 + f64(0.5));
+        f64 r = x - Cast<f64>(k) * ln2;
+
+        f64 term = f64(1);
+        f64 sum = f64(1);
+        for (i32 n = 1; n < 30; ++n)
+        {
+            term *= r / Cast<f64>(n);
+            sum += term;
+        }
+
+        for (; k > i64(0); --k)
+        {
+            sum *= f64(2);
+        }
+        for (; k < i64(0); ++k)
+        {
+            sum /= f64(2);
+        }
+        return sum;
+    }
+
+    [[nodiscard]] constexpr
+    f64 ConstexprLog(f64 x) noexcept
+    {
+        constexpr f64 ln2 = 0.69314718055994530942;
+
+        i32 exponent = 0;
+        while (x >= f64(2))
+        {
+            x /= f64(2);
+            ++exponent;
+        }
+        while (x < f64(1))
+        {
+            x *= f64(2);
+            --exponent;
+        }
+
+        f64 s = (x - f64(1)) / (x + f64(1));
+        f64 s2 = s * s;
+        f64 term = s;
+        f64 sum = f64(0);
+        for (i32 n = 0; n < 40; ++n)
+        {
+            sum += term / Cast<f64>(2 * n + 1);
+            term *= s2;
+        }
+        return f64(2) * sum + Cast<f64>(exponent) * ln2;
+    }
+
+    [[nodiscard]] constexpr
+    f64 ConstexprSqrt(f64 x) noexcept
+    {
+        if (x <= f64(0))
+        {
+            return f64(0);
+        }
+
+        f64 result = (x > f64(1)) ? x : f64(1);
+        for (i32 i = 0; i < 100; ++i)
+        {
+            f64 next = (result + x / result) / f64(2);
+            if (next >= result)
+            {
+                break;
+            }
+            result = next;
+        }
+        return result;
+    }
+
+    struct NormalZigguratTables
+    {
+        static constexpr SizeType Layers = 128;
+        static constexpr f64 R = 3.442619855899;
+        static constexpr f64 V = 9.91256303526217e-3;
+
+        Array<i64, Layers> K;
+        Array<f64, Layers> W;
+        Array<f64, Layers> F;
+    };
+
+    [[nodiscard]] constexpr
+    NormalZigguratTables MakeNormalZigguratTables() noexcept
+    {
+        using Tables = NormalZigguratTables;
+        constexpr SizeType Layers = Tables::Layers;
+        constexpr f64 R = Tables::R;
+        constexpr f64 V = Tables::V;
+
+        constexpr f64 m = 2147483648.0;
+
+        Tables tables;
+        f64 d = R;
+        f64 t = R;
+        f64 q = V / ConstexprExp(f64(-0.5) * d * d);
+
+        tables.K[0] = Trunc<i64>((d / q) * m);
+        tables.K[1] = 0;
+        tables.W[0] = q / m;
+        tables.W[Layers - 1] = d / m;
+        tables.F[0] = f64(1);
+        tables.F[Layers - 1] = ConstexprExp(f64(-0.5) * d * d);
+
+        for (SizeType i = Layers - 2; i >= 1; --i)
+        {
+            d = ConstexprSqrt(f64(-2) * ConstexprLog(V / d + ConstexprExp(f64(-0.5) * d * d)));
+            tables.K[i + 1] = Trunc<i64>((d / t) * m);
+            t = d;
+            tables.F[i] = ConstexprExp(f64(-0.5) * d * d);
+            tables.W[i] = d / m;
+        }
+
+        return tables;
+    }
+
+    class NormalZiggurat final
+    {
+    public:
+        static constexpr SizeType Layers = NormalZigguratTables::Layers;
+        static constexpr f64 R = NormalZigguratTables::R;
+        static constexpr NormalZigguratTables sTables = MakeNormalZigguratTables();
+
+        template <Concept::RandomNumberGenerator RNG>
+        [[nodiscard]] static constexpr
+        f64 Sample(RNG& rng) noexcept
+        {
+            while (true)
+            {
+                u64 bits = GetRandomBits<u64>(rng);
+                SizeType layer = Cast<SizeType>(bits & u64(Layers - 1));
+                i64 value = Cast<i64>(Cast<i32>(bits >> u64(32)));
+
+                if (Abs(value) < sTables.K[layer])
+                {
+                    return Cast<f64>(value) * sTables.W[layer];
+                }
+
+                f64 x = Cast<f64>(value) * sTables.W[layer];
+                if (layer == 0)
+                {
+                    // Note(3011): Sample the tail beyond R with Marsaglia's method.
+                    f64 tail;
+                    f64 y;
+                    do
+                    {
+                        tail = -Log(f64(1) - UniformUnitDistribution<f64>()(rng)) / R;
+                        y = -Log(f64(1) - UniformUnitDistribution<f64>()(rng));
+                    }
+                    while (y + y < tail * tail);
+
+                    return (value > i64(0)) ? R + tail : -R - tail;
+                }
+
+                f64 u = UniformUnitDistribution<f64>()(rng);
+                if (sTables.F[layer] + u * (sTables.F[layer - 1] - sTables.F[layer]) < Exp(f64(-0.5) * x * x))
+                {
+                    return x;
+                }
+            }
+        }
+    };
+
+    struct ExponentialZigguratTables
+    {
+        static constexpr SizeType Layers = 256;
+        static constexpr f64 R = 7.697117470131487;
+        static constexpr f64 V = 3.949659822581572e-3;
+
+        Array<u64, Layers> K;
+        Array<f64, Layers> W;
+        Array<f64, Layers> F;
+    };
+
+    [[nodiscard]] constexpr
+    ExponentialZigguratTables MakeExponentialZigguratTables() noexcept
+    {
+        using Tables = ExponentialZigguratTables;
+        constexpr SizeType Layers = Tables::Layers;
+        constexpr f64 R = Tables::R;
+        constexpr f64 V = Tables::V;
+
+        constexpr f64 m = 4294967296.0;
+
+        Tables tables;
+        f64 d = R;
+        f64 t = R;
+        f64 q = V / ConstexprExp(-d);
+
+        tables.K[0] = Cast<u64>(Trunc<i64>((d / q) * m));
+        tables.K[1] = 0;
+        tables.W[0] = q / m;
+        tables.W[Layers - 1] = d / m;
+        tables.F[0] = f64(1);
+        tables.F[Layers - 1] = ConstexprExp(-d);
+
+        for (SizeType i = Layers - 2; i >= 1; --i)
+        {
+            d = -ConstexprLog(V / d + ConstexprExp(-d));
+            tables.K[i + 1] = Cast<u64>(Trunc<i64>((d / t) * m));
+            t = d;
+            tables.F[i] = ConstexprExp(-d);
+            tables.W[i] = d / m;
+        }
+
+        return tables;
+    }
+
+    class ExponentialZiggurat final
+    {
+    public:
+        static constexpr SizeType Layers = ExponentialZigguratTables::Layers;
+        static constexpr f64 R = ExponentialZigguratTables::R;
+        static constexpr ExponentialZigguratTables sTables = MakeExponentialZigguratTables();
+
+        template <Concept::RandomNumberGenerator RNG>
+        [[nodiscard]] static constexpr
+        f64 Sample(RNG& rng) noexcept
+        {
+            while (true)
+            {
+                u64 bits = GetRandomBits<u64>(rng);
+                SizeType layer = Cast<SizeType>(bits & u64(Layers - 1));
+                u64 value = bits >> u64(32);
+
+                if (value < sTables.K[layer])
+                {
+                    return Cast<f64>(value) * sTables.W[layer];
+                }
+
+                if (layer == 0)
+                {
+                    // Note(3011): The exponential distribution is memoryless,
+                    // so the tail is just another exponential shifted by R.
+                    return R - Log(f64(1) - UniformUnitDistribution<f64>()(rng));
+                }
+
+                f64 x = Cast<f64>(value) * sTables.W[layer];
+                f64 u = UniformUnitDistribution<f64>()(rng);
+                if (sTables.F[layer] + u * (sTables.F[layer - 1] - sTables.F[layer]) < Exp(-x))
+                {
+                    return x;
+                }
+            }
+        }
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_RANDOM_ZIGGURAT_HPP
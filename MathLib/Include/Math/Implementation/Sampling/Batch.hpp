@@ -0,0 +1,144 @@
+#ifndef MATHLIB_IMPLEMENTATION_SAMPLING_BATCH_HPP
+#define MATHLIB_IMPLEMENTATION_SAMPLING_BATCH_HPP
+
+// Note(3011):
+// Structure of arrays versions of the warps. Each component lives in its own
+// span, so the loops have no gathers or scatters and can be vectorized by the
+// compiler. Only the common prefix of all spans is processed.
+
+#include "Warps.hpp"
+
+#include <span>
+
+namespace Math::Sampling
+{
+    template <Concept::StrongFloatType T>
+    struct UniformBatch
+    {
+        std::span<const T> U;
+        std::span<const T> V;
+    };
+
+    template <Concept::StrongFloatType T>
+    struct Sample2Batch
+    {
+        std::span<T> X;
+        std::span<T> Y;
+        std::span<T> PDF;
+    };
+
+    template <Concept::StrongFloatType T>
+    struct Sample3Batch
+    {
+        std::span<T> X;
+        std::span<T> Y;
+        std::span<T> Z;
+        std::span<T> PDF;
+    };
+
+    namespace Implementation
+    {
+        template <Concept::StrongFloatType T>
+        [[nodiscard]] constexpr
+        SizeType BatchSize(const UniformBatch<T>& in, const Sample2Batch<T>& out) noexcept
+        {
+            return Min(Min(Min(SizeType(in.U.size()), SizeType(in.V.size())), Min(SizeType(out.X.size()), SizeType(out.Y.size()))), SizeType(out.PDF.size()));
+        }
+
+        template <Concept::StrongFloatType T>
+        [[nodiscard]] constexpr
+        SizeType BatchSize(const UniformBatch<T>& in, const Sample3Batch<T>& out) noexcept
+        {
+            return Min(BatchSize(in, Sample2Batch<T>{out.X, out.Y, out.PDF}), SizeType(out.Z.size()));
+        }
+
+        template <Concept::StrongFloatType T, typename Warp>
+        constexpr
+        void WarpBatch(const UniformBatch<T>& in, const Sample2Batch<T>& out, Warp warp) noexcept
+        {
+            SizeType count = BatchSize(in, out);
+            for (SizeType i = 0; i < count; ++i)
+            {
+                auto index = ToUnderlying(i);
+                Sample<Vector2T<T>, T> sample = warp(Vector2T<T>(in.U[index], in.V[index]));
+                out.X[index] = sample.Value.x;
+                out.Y[index] = sample.Value.y;
+                out.PDF[index] = sample.PDF;
+            }
+        }
+
+        template <Concept::StrongFloatType T, typename Warp>
+        constexpr
+        void WarpBatch(const UniformBatch<T>& in, const Sample3Batch<T>& out, Warp warp) noexcept
+        {
+            SizeType count = BatchSize(in, out);
+            for (SizeType i = 0; i < count; ++i)
+            {
+                auto index = ToUnderlying(i);
+                Sample<Vector3T<T>, T> sample = warp(Vector2T<T>(in.U[index], in.V[index]));
+                out.X[index] = sample.Value.x;
+                out.Y[index] = sample.Value.y;
+                out.Z[index] = sample.Value.z;
+                out.PDF[index] = sample.PDF;
+            }
+        }
+    }
+
+    template <Concept::StrongFloatType T>
+    constexpr
+    void ConcentricDisk(const UniformBatch<T>& in, const Sample2Batch<T>& out) noexcept
+    {
+        Implementation::WarpBatch(in, out, [](const Vector2T<T>& u) { return ConcentricDisk(u); });
+    }
+
+    template <Concept::StrongFloatType T>
+    constexpr
+    void UniformTriangle(const UniformBatch<T>& in, const Sample2Batch<T>& out) noexcept
+    {
+        Implementation::WarpBatch(in, out, [](const Vector2T<T>& u) { return UniformTriangle(u); });
+    }
+
+    template <Concept::StrongFloatType T>
+    constexpr
+    void UniformSphere(const UniformBatch<T>& in, const Sample3Batch<T>& out) noexcept
+    {
+        Implementation::WarpBatch(in, out, [](const Vector2T<T>& u) { return UniformSphere(u); });
+    }
+
+    template <Concept::StrongFloatType T>
+    constexpr
+    void UniformHemisphere(const UniformBatch<T>& in, const Sample3Batch<T>& out) noexcept
+    {
+        Implementation::WarpBatch(in, out, [](const Vector2T<T>& u) { return UniformHemisphere(u); });
+    }
+
+    template <Concept::StrongFloatType T>
+    constexpr
+    void CosineHemisphere(const UniformBatch<T>& in, const Sample3Batch<T>& out) noexcept
+    {
+        Implementation::WarpBatch(in, out, [](const Vector2T<T>& u) { return CosineHemisphere(u); });
+    }
+
+    template <Concept::StrongFloatType T>
+    constexpr
+    void UniformCone(const UniformBatch<T>& in, const Sample3Batch<T>& out, T cosThetaMax) noexcept
+    {
+        Implementation::WarpBatch(in, out, [cosThetaMax](const Vector2T<T>& u) { return UniformCone(u, cosThetaMax); });
+    }
+
+    template <Concept::StrongFloatType T>
+    constexpr
+    void PhongLobe(const UniformBatch<T>& in, const Sample3Batch<T>& out, T exponent) noexcept
+    {
+        Implementation::WarpBatch(in, out, [exponent](const Vector2T<T>& u) { return PhongLobe(u, exponent); });
+    }
+
+    template <Concept::StrongFloatType T>
+    constexpr
+    void GGX(const UniformBatch<T>& in, const Sample3Batch<T>& out, T alpha) noexcept
+    {
+        Implementation::WarpBatch(in, out, [alpha](const Vector2T<T>& u) { return GGX(u, alpha); });
+    }
+}
+
+#endif //MATHLIB_IMPLEMENTATION_SAMPLING_BATCH_HPP
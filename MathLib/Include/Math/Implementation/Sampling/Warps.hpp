@@ -0,0 +1,217 @@
+#ifndef MATHLIB_IMPLEMENTATION_SAMPLING_WARPS_HPP
+#define MATHLIB_IMPLEMENTATION_SAMPLING_WARPS_HPP
+
+// Note(3011):
+// All warps map uniformly distributed values in [0, 1)^2 onto the target
+// domain, so they work the same with a plain RNG, stratified samples or any
+// of the low discrepancy sequences. Directions are in a local frame where
+// +Z is the normal (or the cone / lobe axis), see OrthonormalBaseFromZ.
+// PDFs are with respect to solid angle for directions and area otherwise.
+
+#include "../../Constants.hpp"
+#include "../../Functions.hpp"
+#include "../../Point.hpp"
+#include "../../Vector.hpp"
+#include "../Geometry/Shapes.hpp"
+
+namespace Math::Sampling
+{
+    template <typename V, Concept::StrongFloatType T>
+    struct Sample
+    {
+        V Value;
+        T PDF;
+    };
+
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    Sample<Vector2T<T>, T> ConcentricDisk(const Vector2T<T>& u) noexcept
+    {
+        // Note(3011): Shirley and Chiu's mapping, which keeps adjacent strata
+        // adjacent and has much less distortion than the polar mapping.
+        T a = Cast<T>(2) * u.x - Cast<T>(1);
+        T b = Cast<T>(2) * u.y - Cast<T>(1);
+        T pdf = Cast<T>(1) / Constant::Pi<T>;
+
+        if (a == Cast<T>(0) && b == Cast<T>(0))
+        {
+            return {Vector2T<T>(Cast<T>(0)), pdf};
+        }
+
+        T r;
+        T phi;
+        if (Abs(a) > Abs(b))
+        {
+            r = a;
+            phi = (Constant::Pi<T> / Cast<T>(4)) * (b / a);
+        }
+        else
+        {
+            r = b;
+            phi = Constant::PiDiv2<T> - (Constant::Pi<T> / Cast<T>(4)) * (a / b);
+        }
+        return {Vector2T<T>(r * Cos(phi), r * Sin(phi)), pdf};
+    }
+
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    T UniformSpherePDF() noexcept
+    {
+        return Cast<T>(1) / (Cast<T>(2) * Constant::Tau<T>);
+    }
+
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    Sample<Vector3T<T>, T> UniformSphere(const Vector2T<T>& u) noexcept
+    {
+        T z = Cast<T>(1) - Cast<T>(2) * u.x;
+        T r = Sqrt(Max(Cast<T>(0), Cast<T>(1) - z * z));
+        T phi = Constant::Tau<T> * u.y;
+        return {Vector3T<T>(r * Cos(phi), r * Sin(phi), z), UniformSpherePDF<T>()};
+    }
+
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    Sample<Point3T<T>, T> UniformSphere(const Geometry::Sphere<T>& sphere, const Vector2T<T>& u) noexcept
+    {
+        Vector3T<T> direction = UniformSphere(u).Value;
+        T area = Cast<T>(2) * Constant::Tau<T> * sphere.Radius * sphere.Radius;
+        return {sphere.Center + direction * sphere.Radius, Cast<T>(1) / area};
+    }
+
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    T UniformHemispherePDF() noexcept
+    {
+        return Cast<T>(1) / Constant::Tau<T>;
+    }
+
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    Sample<Vector3T<T>, T> UniformHemisphere(const Vector2T<T>& u) noexcept
+    {
+        T z = u.x;
+        T r = Sqrt(Max(Cast<T>(0), Cast<T>(1) - z * z));
+        T phi = Constant::Tau<T> * u.y;
+        return {Vector3T<T>(r * Cos(phi), r * Sin(phi), z), UniformHemispherePDF<T>()};
+    }
+
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    T CosineHemispherePDF(T cosTheta) noexcept
+    {
+        return Max(Cast<T>(0), cosTheta) / Constant::Pi<T>;
+    }
+
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    Sample<Vector3T<T>, T> CosineHemisphere(const Vector2T<T>& u) noexcept
+    {
+        // Note(3011): Malley's method, project the concentric disk up.
+        Vector2T<T> disk = ConcentricDisk(u).Value;
+        T z = Sqrt(Max(Cast<T>(0), Cast<T>(1) - disk.x * disk.x - disk.y * disk.y));
+        return {Vector3T<T>(disk, z), CosineHemispherePDF(z)};
+    }
+
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    T UniformConePDF(T cosThetaMax) noexcept
+    {
+        return Cast<T>(1) / (Constant::Tau<T> * (Cast<T>(1) - cosThetaMax));
+    }
+
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    Sample<Vector3T<T>, T> UniformCone(const Vector2T<T>& u, T cosThetaMax) noexcept
+    {
+        T cosTheta = Cast<T>(1) - u.x * (Cast<T>(1) - cosThetaMax);
+        T sinTheta = Sqrt(Max(Cast<T>(0), Cast<T>(1) - cosTheta * cosTheta));
+        T phi = Constant::Tau<T> * u.y;
+        return {Vector3T<T>(sinTheta * Cos(phi), sinTheta * Sin(phi), cosTheta), UniformConePDF(cosThetaMax)};
+    }
+
+    // Note(3011): Returns the barycentric weights of B and C, the weight of A
+    // is 1 - x - y. This is Heitz's "low-distortion map" (2019), which needs
+    // no square root and keeps stratification better than the classic
+    // sqrt based mapping. The PDF is with respect to the barycentric domain.
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    Sample<Vector2T<T>, T> UniformTriangle(const Vector2T<T>& u) noexcept
+    {
+        T b0;
+        T b1;
+        if (u.y > u.x)
+        {
+            b0 = u.x / Cast<T>(2);
+            b1 = u.y - b0;
+        }
+        else
+        {
+            b1 = u.y / Cast<T>(2);
+            b0 = u.x - b1;
+        }
+        return {Vector2T<T>(b0, b1), Cast<T>(2)};
+    }
+
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    Sample<Point3T<T>, T> UniformTriangle(const Geometry::Triangle<T>& triangle, const Vector2T<T>& u) noexcept
+    {
+        Vector2T<T> barycentric = UniformTriangle(u).Value;
+        Vector3T<T> ab = triangle.B - triangle.A;
+        Vector3T<T> ac = triangle.C - triangle.A;
+        T area = Cross(ab, ac).Length() / Cast<T>(2);
+        return {triangle.A + ab * barycentric.x + ac * barycentric.y, Cast<T>(1) / area};
+    }
+
+    // Note(3011): Normalized Phong lobe, cos^n around +Z.
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    T PhongLobePDF(T cosTheta, T exponent) noexcept
+    {
+        if (cosTheta <= Cast<T>(0))
+        {
+            return Cast<T>(0);
+        }
+        return (exponent + Cast<T>(1)) / Constant::Tau<T> * Pow(cosTheta, exponent);
+    }
+
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    Sample<Vector3T<T>, T> PhongLobe(const Vector2T<T>& u, T exponent) noexcept
+    {
+        T cosTheta = Pow(u.x, Cast<T>(1) / (exponent + Cast<T>(1)));
+        T sinTheta = Sqrt(Max(Cast<T>(0), Cast<T>(1) - cosTheta * cosTheta));
+        T phi = Constant::Tau<T> * u.y;
+        return {Vector3T<T>(sinTheta * Cos(phi), sinTheta * Sin(phi), cosTheta), PhongLobePDF(cosTheta, exponent)};
+    }
+
+    // Note(3011): Isotropic GGX (Trowbridge-Reitz) microfacet normals around
+    // +Z, distributed proportionally to D(h) cos(theta_h). Converting the PDF
+    // to the reflected direction is left to the caller (divide by 4 |o.h|).
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    T GGXPDF(T cosTheta, T alpha) noexcept
+    {
+        if (cosTheta <= Cast<T>(0))
+        {
+            return Cast<T>(0);
+        }
+        T alpha2 = alpha * alpha;
+        T denominator = cosTheta * cosTheta * (alpha2 - Cast<T>(1)) + Cast<T>(1);
+        return alpha2 * cosTheta / (Constant::Pi<T> * denominator * denominator);
+    }
+
+    template <Concept::StrongFloatType T>
+    [[nodiscard]] constexpr
+    Sample<Vector3T<T>, T> GGX(const Vector2T<T>& u, T alpha) noexcept
+    {
+        T cos2Theta = (Cast<T>(1) - u.x) / (Cast<T>(1) + (alpha * alpha - Cast<T>(1)) * u.x);
+        T cosTheta = Sqrt(Max(Cast<T>(0), cos2Theta));
+        T sinTheta = Sqrt(Max(Cast<T>(0), Cast<T>(1) - cos2Theta));
+        T phi = Constant::Tau<T> * u.y;
+        return {Vector3T<T>(sinTheta * Cos(phi), sinTheta * Sin(phi), cosTheta), GGXPDF(cosTheta, alpha)};
+    }
+}
+
+#endif //MATHLIB_IMPLEMENTATION_SAMPLING_WARPS_HPP
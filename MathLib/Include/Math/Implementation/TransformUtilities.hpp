@@ -5,6 +5,7 @@
 #include "../Functions.hpp"
 #include "Point.hpp"
 #include "MatrixOperators.hpp"
+#include "MatrixUtilities.hpp"
 #include "Transform.hpp"
 
 namespace Math
@@ -237,6 +238,35 @@ namespace Math
         return result;
     }
 
+    // Note(3011): Inverse of an affine transform, the inverse of the linear
+    // part and the translation moved back through it.
+    template <Concept::Scalar Scalar>
+    [[nodiscard]] constexpr
+    Transform2T<Scalar> Invert(const Transform2T<Scalar>& t) noexcept
+    {
+        Matrix2T<Scalar> linear = Invert(Matrix2T<Scalar>(
+            t[0][0], t[0][1],
+            t[1][0], t[1][1]
+        ));
+        return Transform2T<Scalar>(
+            linear, linear * -Vector2T<Scalar>(t[0][2], t[1][2])
+        );
+    }
+
+    template <Concept::Scalar Scalar>
+    [[nodiscard]] constexpr
+    Transform3T<Scalar> Invert(const Transform3T<Scalar>& t) noexcept
+    {
+        Matrix3T<Scalar> linear = Invert(Matrix3T<Scalar>(
+            t[0][0], t[0][1], t[0][2],
+            t[1][0], t[1][1], t[1][2],
+            t[2][0], t[2][1], t[2][2]
+        ));
+        return Transform3T<Scalar>(
+            linear, linear * -Vector3T<Scalar>(t[0][3], t[1][3], t[2][3])
+        );
+    }
+
     template <Concept::Scalar Scalar>
     [[nodiscard]] constexpr
     Transform3T<Scalar> OrthonormalBaseFromZ(const Vector3T<Scalar>& z) noexcept
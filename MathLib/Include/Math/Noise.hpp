@@ -2,5 +2,10 @@
 #define MATHLIB_NOISE_HPP
 
 #include "Implementation/Noise/Perlin.hpp"
+#include "Implementation/Noise/Simplex.hpp"
+#include "Implementation/Noise/Worley.hpp"
+#include "Implementation/Noise/Layer.hpp"
+#include "Implementation/Noise/Bake.hpp"
+#include "Implementation/Noise/Baked.hpp"
 
 #endif //MATHLIB_NOISE_HPP
@@ -4,6 +4,14 @@
 #include "Implementation/Random/Xoshiro.hpp"
 #include "Implementation/Random/UniformDistribution.hpp"
 #include "Implementation/Random/PoissonDistribution.hpp"
+#include "Implementation/Random/NormalDistribution.hpp"
+#include "Implementation/Random/ExponentialDistribution.hpp"
+#include "Implementation/Random/GammaDistribution.hpp"
+#include "Implementation/Random/DiscreteDistribution.hpp"
+#include "Implementation/Random/Shuffle.hpp"
+#include "Implementation/Random/Sobol.hpp"
+#include "Implementation/Random/Halton.hpp"
+#include "Implementation/Random/RSequence.hpp"
 
 namespace Math
 {
@@ -15,6 +23,13 @@ namespace Math
 
     static_assert(Concept::Distribution<UniformDistribution<u32>, Random32>);
     static_assert(Concept::Distribution<UniformDistribution<u64>, Random64>);
+
+    static_assert(Concept::Distribution<NormalDistribution<f32>, Random32>);
+    static_assert(Concept::Distribution<NormalDistribution<f64>, Random64>);
+    static_assert(Concept::Distribution<ExponentialDistribution<f32>, Random32>);
+    static_assert(Concept::Distribution<ExponentialDistribution<f64>, Random64>);
+    static_assert(Concept::Distribution<GammaDistribution<f32>, Random32>);
+    static_assert(Concept::Distribution<GammaDistribution<f64>, Random64>);
 }
 
 #endif //MATHLIB_RANDOM_HPP
@@ -0,0 +1,7 @@
+#ifndef MATHLIB_SAMPLING_HPP
+#define MATHLIB_SAMPLING_HPP
+
+#include "Implementation/Sampling/Warps.hpp"
+#include "Implementation/Sampling/Batch.hpp"
+
+#endif //MATHLIB_SAMPLING_HPP
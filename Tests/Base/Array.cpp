@@ -68,10 +68,10 @@ TEST_CASE("Test Array basics", "[Math][Common]")
         Math::Random64 random;
         Math::Array<f32, 4> array(1.0f, 2.0f, 3.0f, 4.0f);
         array.Shuffle<Math::Random64, Math::UniformDistribution>(random);
-        REQUIRE(Equal(array[0], 4.0f));
-        REQUIRE(Equal(array[1], 3.0f));
-        REQUIRE(Equal(array[2], 1.0f));
-        REQUIRE(Equal(array[3], 2.0f));
+        REQUIRE(Equal(array[0], 2.0f));
+        REQUIRE(Equal(array[1], 4.0f));
+        REQUIRE(Equal(array[2], 3.0f));
+        REQUIRE(Equal(array[3], 1.0f));
     }
 
     SECTION("Min and Max")
@@ -318,3 +318,39 @@ TEST_CASE("Test Frac functions", "[Math][Functions]")
         REQUIRE(Equal(Frac(2.5f), 0.5f));
     }
 }
+
+TEST_CASE("Test Smoothstep and Smootherstep derivatives", "[Math][Functions]")
+{
+    using Math::Smoothstep;
+    using Math::SmoothstepDerivative;
+    using Math::Smootherstep;
+    using Math::SmootherstepDerivative;
+
+    SECTION("Test derivatives with f32")
+    {
+        REQUIRE(Equal(SmoothstepDerivative(f32(0.0f), f32(0.0f), f32(1.0f)), 0.0f));
+        REQUIRE(Equal(SmoothstepDerivative(f32(0.5f), f32(0.0f), f32(1.0f)), 1.5f));
+        REQUIRE(Equal(SmoothstepDerivative(f32(1.0f), f32(0.0f), f32(1.0f)), 0.0f));
+        REQUIRE(Equal(SmoothstepDerivative(f32(4.0f), f32(-4.0f), f32(12.0f)), 1.5f / 16.0f));
+        REQUIRE(Equal(SmoothstepDerivative(f32(-5.0f), f32(-4.0f), f32(12.0f)), 0.0f));
+
+        REQUIRE(Equal(SmootherstepDerivative(f32(0.0f), f32(0.0f), f32(1.0f)), 0.0f));
+        REQUIRE(Equal(SmootherstepDerivative(f32(0.5f), f32(0.0f), f32(1.0f)), 1.875f));
+        REQUIRE(Equal(SmootherstepDerivative(f32(1.0f), f32(0.0f), f32(1.0f)), 0.0f));
+        REQUIRE(Equal(SmootherstepDerivative(f32(4.0f), f32(-4.0f), f32(12.0f)), 1.875f / 16.0f));
+        REQUIRE(Equal(SmootherstepDerivative(f32(13.0f), f32(-4.0f), f32(12.0f)), 0.0f));
+    }
+
+    SECTION("Test derivatives against finite differences")
+    {
+        constexpr f32 h = 1e-3f;
+        for (int i = 1; i < 20; ++i)
+        {
+            f32 x = f32(i * 0.05f);
+            f32 smooth = (Smoothstep(x + h, f32(0.0f), f32(1.0f)) - Smoothstep(x - h, f32(0.0f), f32(1.0f))) / (2.0f * h);
+            f32 smoother = (Smootherstep(x + h, f32(0.0f), f32(1.0f)) - Smootherstep(x - h, f32(0.0f), f32(1.0f))) / (2.0f * h);
+            REQUIRE(Equal(SmoothstepDerivative(x, f32(0.0f), f32(1.0f)), smooth, f32(1e-2f)));
+            REQUIRE(Equal(SmootherstepDerivative(x, f32(0.0f), f32(1.0f)), smoother, f32(1e-2f)));
+        }
+    }
+}
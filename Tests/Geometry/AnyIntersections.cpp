@@ -0,0 +1,87 @@
+#include "GeometryTestsCommon.hpp"
+
+#include <vector>
+
+using namespace Math::Types;
+using namespace Math::Geometry;
+
+namespace
+{
+    template <typename Shape>
+    void RequireSameAnswer(const Ray<f32>& ray, const Interval<f32>& interval, const Shape& shape)
+    {
+        REQUIRE(AnyIntersection(ray, interval, shape) == NearestIntersection(ray, interval, shape).IsValid());
+    }
+}
+
+TEST_CASE("Any hit intersections", "[Math][Geometry][AnyIntersection]")
+{
+    RandomGeometry random(Math::u64(73));
+    auto interval = [&]() { return random.Unit() < f32(0.5) ? Interval<f32>() : Interval<f32>(random.Unit() * f32(4) - f32(1), random.Unit() * f32(8)); };
+
+    SECTION("Same answer as the nearest hit")
+    {
+        int hits = 0;
+        for (int i = 0; i < 5000; ++i)
+        {
+            Ray<f32> ray(random.Point3(f32(8)), random.Vector3());
+            Interval<f32> range = interval();
+            Sphere<f32> sphere(random.Point3(f32(4)), f32(0.2) + random.Unit());
+            RequireSameAnswer(ray, range, sphere);
+            RequireSameAnswer(ray, range, Triangle<f32>(random.Point3(f32(6)), random.Point3(f32(6)), random.Point3(f32(6))));
+            RequireSameAnswer(ray, range, Plane<f32>(random.Point3(f32(4)), Math::Normalize(random.Vector3())));
+            RequireSameAnswer(ray, range, Box<f32>(random.Point3(f32(6)), random.Point3(f32(6))));
+            hits += AnyIntersection(ray, range, sphere) ? 1 : 0;
+        }
+        REQUIRE(hits > 50);
+
+        // Note(3011): Rays inside a sphere and rays lying in planes.
+        Sphere<f32> sphere(Point<f32>(f32(0), f32(0), f32(0)), f32(1));
+        RequireSameAnswer(Ray<f32>(Point<f32>(f32(0), f32(0), f32(0)), Math::Vector3f(f32(1), f32(0), f32(0))), {}, sphere);
+        REQUIRE(AnyIntersection(Ray<f32>(Point<f32>(f32(0), f32(0), f32(0)), Math::Vector3f(f32(1), f32(0), f32(0))), {}, sphere));
+        REQUIRE_FALSE(AnyIntersection(Ray<f32>(Point<f32>(f32(0), f32(0), f32(-3)), Math::Vector3f(f32(0), f32(0), f32(-1))), {}, sphere));
+        REQUIRE(AnyIntersection(Ray<f32>(Point<f32>(f32(0), f32(0), f32(-3)), Math::Vector3f(f32(0), f32(0), f32(-1))), Interval<f32>(-f32(5), f32(5)), sphere));
+
+        Plane<f32> plane(Point<f32>(f32(0), f32(0), f32(0)), Math::Vector3f(f32(0), f32(1), f32(0)));
+        RequireSameAnswer(Ray<f32>(Point<f32>(f32(0), f32(0), f32(0)), Math::Vector3f(f32(1), f32(0), f32(0))), {}, plane);
+        RequireSameAnswer(Ray<f32>(Point<f32>(f32(0), f32(1), f32(0)), Math::Vector3f(f32(1), f32(0), f32(0))), {}, plane);
+    }
+
+    SECTION("Spans stop at the first hit")
+    {
+        std::vector<Sphere<f32>> spheres;
+        for (int i = 0; i < 50; ++i)
+        {
+            spheres.emplace_back(random.Point3(f32(10)), f32(0.1) + random.Unit() * f32(0.3));
+        }
+        std::span<const Sphere<f32>> sphereSpan(spheres);
+        BVH<f32> tree(sphereSpan);
+        for (int i = 0; i < 1000; ++i)
+        {
+            Ray<f32> ray(random.Point3(f32(12)), random.Vector3());
+            bool expected = false;
+            for (const Sphere<f32>& sphere : spheres)
+            {
+                expected |= NearestIntersection(ray, {}, sphere).IsValid();
+            }
+            REQUIRE(AnyIntersection(ray, {}, sphereSpan) == expected);
+            REQUIRE(HasIntersection(ray, {}, tree, sphereSpan) == expected);
+        }
+    }
+
+    SECTION("Packets")
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            RayPacket4<f32> packet;
+            for (SizeType lane = 0; lane < 3; ++lane)
+            {
+                packet.Set(lane, Ray<f32>(random.Point3(f32(8)), random.Vector3()), interval());
+            }
+            RequireAnyLanesMatch(packet, Sphere<f32>(random.Point3(f32(4)), f32(0.2) + random.Unit()));
+            RequireAnyLanesMatch(packet, Triangle<f32>(random.Point3(f32(6)), random.Point3(f32(6)), random.Point3(f32(6))));
+            RequireAnyLanesMatch(packet, Plane<f32>(random.Point3(f32(4)), Math::Normalize(random.Vector3())));
+            RequireAnyLanesMatch(packet, Box<f32>(random.Point3(f32(6)), random.Point3(f32(6))));
+        }
+    }
+}
@@ -0,0 +1,155 @@
+#include "GeometryTestsCommon.hpp"
+
+#include <vector>
+
+using namespace Math::Types;
+using namespace Math::Geometry;
+
+namespace
+{
+    template <typename Shape>
+    Intersection<f32> BruteForce(const Ray<f32>& ray, const Interval<f32>& interval, const std::vector<Shape>& shapes, SizeType& index)
+    {
+        Intersection<f32> nearest(f32::NaN());
+        for (SizeType i = 0; i < SizeType(shapes.size()); ++i)
+        {
+            Intersection<f32> hit = NearestIntersection(ray, interval, shapes[Math::ToUnderlying(i)]);
+            if (hit && (!nearest || hit.Distance < nearest.Distance))
+            {
+                nearest = hit;
+                index = i;
+            }
+        }
+        return nearest;
+    }
+}
+
+TEST_CASE("BVH over 3D shapes", "[Math][Geometry][BVH]")
+{
+    RandomGeometry random(Math::u64(53));
+
+    std::vector<Sphere<f32>> spheres;
+    for (int i = 0; i < 500; ++i)
+    {
+        spheres.emplace_back(random.Point3(f32(20)), f32(0.05) + random.Unit() * f32(0.4));
+    }
+
+    std::vector<Triangle<f32>> triangles;
+    for (int i = 0; i < 500; ++i)
+    {
+        Point<f32> a = random.Point3(f32(20));
+        triangles.emplace_back(a, a + Math::Vector3f(random.Point3(f32(2))), a + Math::Vector3f(random.Point3(f32(2))));
+    }
+
+    std::span<const Sphere<f32>> sphereSpan(spheres);
+    std::span<const Triangle<f32>> triangleSpan(triangles);
+
+    SECTION("Nearest hits match testing every shape")
+    {
+        BVH<f32> sphereTree(sphereSpan);
+        BVH<f32> triangleTree(triangleSpan, 2);
+        int hits = 0;
+        for (int i = 0; i < 2000; ++i)
+        {
+            Ray<f32> ray(random.Point3(f32(24)), Math::Normalize(random.Vector3()));
+
+            SizeType expectedIndex = 0;
+            Intersection<f32> expected = BruteForce(ray, {}, spheres, expectedIndex);
+            BVH<f32>::Hit hit = NearestIntersection(ray, {}, sphereTree, sphereSpan);
+            REQUIRE(hit.IsValid() == expected.IsValid());
+            if (hit)
+            {
+                ++hits;
+                REQUIRE(hit.Distance == expected.Distance);
+                REQUIRE(hit.Index == expectedIndex);
+            }
+            REQUIRE(HasIntersection(ray, {}, sphereTree, sphereSpan) == expected.IsValid());
+
+            expected = BruteForce(ray, {}, triangles, expectedIndex);
+            hit = NearestIntersection(ray, {}, triangleTree, triangleSpan);
+            REQUIRE(hit.IsValid() == expected.IsValid());
+            if (hit)
+            {
+                REQUIRE(hit.Distance == expected.Distance);
+                REQUIRE(hit.Index == expectedIndex);
+            }
+        }
+        REQUIRE(hits > 100);
+    }
+
+    SECTION("Intervals limit the hits")
+    {
+        BVH<f32> tree(sphereSpan);
+        for (int i = 0; i < 500; ++i)
+        {
+            Ray<f32> ray(random.Point3(f32(24)), Math::Normalize(random.Vector3()));
+            Interval<f32> interval(f32(2), f32(6));
+            SizeType expectedIndex = 0;
+            Intersection<f32> expected = BruteForce(ray, interval, spheres, expectedIndex);
+            BVH<f32>::Hit hit = NearestIntersection(ray, interval, tree, sphereSpan);
+            REQUIRE(hit.IsValid() == expected.IsValid());
+            REQUIRE(HasIntersection(ray, interval, tree, sphereSpan) == expected.IsValid());
+        }
+    }
+
+    SECTION("Every primitive is in exactly one leaf")
+    {
+        BVH<f32> tree(triangleSpan, 3);
+        std::vector<int> seen(triangles.size(), 0);
+        for (const BVH<f32>::Node& node : tree.Nodes())
+        {
+            if (node.Count > u32(0))
+            {
+                REQUIRE(node.Count <= u32(3));
+                for (u32 i = node.Offset; i < node.Offset + node.Count; ++i)
+                {
+                    u32 index = tree.Indices()[Math::ToUnderlying(i)];
+                    ++seen[Math::ToUnderlying(index)];
+
+                    Box<f32> bounds = BoundingBox(triangles[Math::ToUnderlying(index)]);
+                    REQUIRE(node.Bounds.Min.x <= bounds.Min.x);
+                    REQUIRE(node.Bounds.Max.y >= bounds.Max.y);
+                }
+            }
+        }
+        for (int count : seen)
+        {
+            REQUIRE(count == 1);
+        }
+    }
+
+    SECTION("Planes are tested on every ray")
+    {
+        std::vector<Plane<f32>> planes = {
+            Plane<f32>(Point<f32>(f32(0), f32(-1), f32(0)), Math::Vector3f(f32(0), f32(1), f32(0))),
+            Plane<f32>(Point<f32>(f32(0), f32(0), f32(5)), Math::Vector3f(f32(0), f32(0), f32(-1))),
+        };
+        std::span<const Plane<f32>> planeSpan(planes);
+        BVH<f32> tree(planeSpan);
+        REQUIRE(tree.Nodes().empty());
+        REQUIRE(tree.Unbounded().size() == 2);
+
+        Ray<f32> ray(Point<f32>(f32(0), f32(0), f32(0)), Math::Vector3f(f32(0), f32(-1), f32(1)));
+        BVH<f32>::Hit hit = NearestIntersection(ray, {}, tree, planeSpan);
+        REQUIRE(hit);
+        REQUIRE(hit.Index == 0);
+        REQUIRE(hit.Distance == f32(1));
+    }
+
+    SECTION("Coincident and empty inputs")
+    {
+        std::vector<Sphere<f32>> stacked(40, Sphere<f32>(Point<f32>(f32(1), f32(2), f32(3)), f32(1)));
+        std::span<const Sphere<f32>> stackedSpan(stacked);
+        BVH<f32> tree(stackedSpan, 4);
+        for (const BVH<f32>::Node& node : tree.Nodes())
+        {
+            REQUIRE(node.Count <= u32(4));
+        }
+        Ray<f32> ray(Point<f32>(f32(1), f32(2), f32(-5)), Math::Vector3f(f32(0), f32(0), f32(1)));
+        REQUIRE(NearestIntersection(ray, {}, tree, stackedSpan).Distance == f32(7));
+
+        BVH<f32> empty;
+        REQUIRE_FALSE(NearestIntersection(ray, {}, empty, std::span<const Sphere<f32>>()));
+        REQUIRE_FALSE(HasIntersection(ray, {}, empty, std::span<const Sphere<f32>>()));
+    }
+}
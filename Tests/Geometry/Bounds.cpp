@@ -0,0 +1,118 @@
+#include "GeometryTestsCommon.hpp"
+
+#include <vector>
+
+using namespace Math::Types;
+using namespace Math::Geometry;
+
+TEST_CASE("Bounding boxes", "[Math][Geometry][Bounds]")
+{
+    RandomGeometry random(Math::u64(83));
+    auto transform = [&]()
+    {
+        return Math::Translate(random.Vector3() * f32(10)) *
+               Math::RotateZ(random.Unit() * f32(6)) * Math::RotateX(random.Unit() * f32(6)) *
+               Math::Scale(Math::Vector3f(f32(0.5) + random.Unit(), f32(0.5) + random.Unit(), f32(-0.5) - random.Unit()));
+    };
+
+    SECTION("Shapes")
+    {
+        Box<f32> sphere = BoundingBox(Sphere<f32>(Point<f32>(f32(1), f32(2), f32(3)), f32(2)));
+        REQUIRE(Same(sphere.Min, Point<f32>(f32(-1), f32(0), f32(1))));
+        REQUIRE(Same(sphere.Max, Point<f32>(f32(3), f32(4), f32(5))));
+
+        Box<f32> triangle = BoundingBox(Triangle<f32>(Point<f32>(f32(0), f32(5), f32(-1)), Point<f32>(f32(2), f32(1), f32(0)), Point<f32>(f32(-3), f32(0), f32(4))));
+        REQUIRE(Same(triangle.Min, Point<f32>(f32(-3), f32(0), f32(-1))));
+        REQUIRE(Same(triangle.Max, Point<f32>(f32(2), f32(5), f32(4))));
+    }
+
+    SECTION("Transformed boxes")
+    {
+        for (int i = 0; i < 500; ++i)
+        {
+            Math::Transform3f t = transform();
+            Box<f32> box(random.Point3(f32(6)), random.Point3(f32(6)));
+
+            Implementation::GrowingBox<f32> corners;
+            for (int corner = 0; corner < 8; ++corner)
+            {
+                corners.Grow(t * Point<f32>((corner & 1) ? box.Max.x : box.Min.x, (corner & 2) ? box.Max.y : box.Min.y, (corner & 4) ? box.Max.z : box.Min.z));
+            }
+            REQUIRE(Near(BoundingBox(t, box), Box<f32>(corners.Min, corners.Max)));
+
+            Triangle<f32> triangle(random.Point3(f32(6)), random.Point3(f32(6)), random.Point3(f32(6)));
+            Box<f32> tight = BoundingBox(t, triangle);
+            REQUIRE(Same(tight, BoundingBox(Triangle<f32>(t * triangle.A, t * triangle.B, t * triangle.C))));
+            REQUIRE(Overlaps(tight, BoundingBox(t, BoundingBox(triangle))));
+            REQUIRE(Near(Union(tight, BoundingBox(t, BoundingBox(triangle))), BoundingBox(t, BoundingBox(triangle))));
+        }
+
+        Box<f32> box(Point<f32>(f32(1), f32(2), f32(3)), Point<f32>(f32(2), f32(4), f32(6)));
+        Box<f32> moved = BoundingBox(Math::Translate(Math::Vector3f(f32(1), f32(-1), f32(0))), box);
+        REQUIRE(Same(moved.Min, Point<f32>(f32(2), f32(1), f32(3))));
+        REQUIRE(Same(moved.Max, Point<f32>(f32(3), f32(3), f32(6))));
+    }
+
+    SECTION("Overlaps, Intersect, Union and SurfaceArea")
+    {
+        Box<f32> a(Point<f32>(f32(0), f32(0), f32(0)), Point<f32>(f32(2), f32(2), f32(2)));
+        Box<f32> b(Point<f32>(f32(1), f32(-1), f32(1)), Point<f32>(f32(3), f32(1), f32(4)));
+        Box<f32> c(Point<f32>(f32(2), f32(0), f32(5)), Point<f32>(f32(4), f32(1), f32(6)));
+
+        REQUIRE(Overlaps(a, b));
+        REQUIRE(Overlaps(b, a));
+        REQUIRE_FALSE(Overlaps(a, c));
+        REQUIRE(Overlaps(a, Box<f32>(Point<f32>(f32(2), f32(2), f32(2)), Point<f32>(f32(3), f32(3), f32(3)))));
+
+        Box<f32> overlap = Intersect(a, b);
+        REQUIRE(Same(overlap.Min, Point<f32>(f32(1), f32(0), f32(1))));
+        REQUIRE(Same(overlap.Max, Point<f32>(f32(2), f32(1), f32(2))));
+        REQUIRE(SurfaceArea(overlap) == f32(6));
+        REQUIRE(Same(Intersect(a, a), a));
+
+        Box<f32> apart = Intersect(a, c);
+        REQUIRE(apart.Min.z == f32(5));
+        REQUIRE(apart.Max.z == f32(5));
+
+        Box<f32> both = Union(a, b);
+        REQUIRE(Same(both.Min, Point<f32>(f32(0), f32(-1), f32(0))));
+        REQUIRE(Same(both.Max, Point<f32>(f32(3), f32(2), f32(4))));
+        REQUIRE(SurfaceArea(both) == f32(2) * (f32(9) + f32(12) + f32(12)));
+    }
+
+    SECTION("Spans")
+    {
+        std::vector<Sphere<f32>> spheres;
+        std::vector<Box<f32>> boxes;
+        for (int i = 0; i < 1000; ++i)
+        {
+            spheres.emplace_back(random.Point3(f32(50)), random.Unit());
+            boxes.emplace_back(random.Point3(f32(50)), random.Point3(f32(50)));
+        }
+        std::span<const Sphere<f32>> sphereSpan(spheres);
+        std::span<const Box<f32>> boxSpan(boxes);
+
+        std::vector<Box<f32>> sphereBoxes = BoundingBoxes(sphereSpan);
+        REQUIRE(sphereBoxes.size() == spheres.size());
+        Box<f32> all = sphereBoxes[0];
+        for (std::size_t i = 0; i < spheres.size(); ++i)
+        {
+            REQUIRE(Same(sphereBoxes[i], BoundingBox(spheres[i])));
+            all = Union(all, sphereBoxes[i]);
+        }
+        REQUIRE(Same(BoundingBox(sphereSpan), all));
+
+        Math::Transform3f t = transform();
+        std::vector<Box<f32>> transformed = BoundingBoxes(t, boxSpan);
+        REQUIRE(transformed.size() == boxes.size());
+        for (std::size_t i = 0; i < boxes.size(); ++i)
+        {
+            REQUIRE(Same(transformed[i], BoundingBox(t, boxes[i])));
+        }
+
+        Box<f32> empty = BoundingBox(std::span<const Box<f32>>());
+        REQUIRE(Same(empty.Min, Point<f32>(f32(0))));
+        REQUIRE(Same(empty.Max, Point<f32>(f32(0))));
+        REQUIRE(BoundingBoxes(t, std::span<const Box<f32>>()).empty());
+    }
+}
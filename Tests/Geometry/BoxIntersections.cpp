@@ -0,0 +1,97 @@
+#include "GeometryTestsCommon.hpp"
+
+#include <vector>
+
+using namespace Math::Types;
+using namespace Math::Geometry;
+
+TEST_CASE("Ray box slab tests", "[Math][Geometry][Box]")
+{
+    RandomGeometry random(Math::u64(67));
+
+    Box<f32> box(Point<f32>(f32(-1), f32(-1), f32(-1)), Point<f32>(f32(1), f32(2), f32(3)));
+
+    SECTION("Entry and exit")
+    {
+        RayWithInverse<f32> ray(Ray<f32>(Point<f32>(f32(0), f32(0), f32(-5)), Math::Vector3f(f32(0), f32(0), f32(2))));
+        REQUIRE(ray.InverseDirection.z == f32(0.5));
+
+        BoxIntersection<f32> range = SlabIntersection(ray, {}, box);
+        REQUIRE(range);
+        REQUIRE(range.Entry == f32(2));
+        REQUIRE(range.Exit == f32(4));
+
+        range = SlabIntersection(ray, Interval<f32>(f32(3), f32(3.5)), box);
+        REQUIRE(range.Entry == f32(3));
+        REQUIRE(range.Exit == f32(3.5));
+
+        REQUIRE_FALSE(SlabIntersection(ray, Interval<f32>(f32(0), f32(1)), box));
+        REQUIRE_FALSE(SlabIntersection(ray, Interval<f32>(f32(5), f32(9)), box));
+
+        RayWithInverse<f32> inside(Ray<f32>(Point<f32>(f32(0), f32(0), f32(0)), Math::Vector3f(f32(0), f32(-1), f32(0))));
+        range = SlabIntersection(inside, {}, box);
+        REQUIRE(range.Entry == Math::Constant::GeometryEpsilon<f32>);
+        REQUIRE(range.Exit == f32(1));
+        REQUIRE(NearestIntersection(inside, {}, box).Distance == f32(1));
+        REQUIRE(NearestIntersection(ray, {}, box).Distance == f32(2));
+    }
+
+    SECTION("Rays in the plane of a face")
+    {
+        // Note(3011): Every combination of signed zero directions and faces,
+        // none of them may produce a NaN that turns a hit into a miss.
+        for (f32 zero : { f32(0), -f32(0) })
+        {
+            for (f32 face : { f32(-1), f32(1) })
+            {
+                RayWithInverse<f32> ray(Ray<f32>(Point<f32>(face, f32(0), f32(-5)), Math::Vector3f(zero, f32(0), f32(1))));
+                BoxIntersection<f32> range = SlabIntersection(ray, {}, box);
+                REQUIRE(range);
+                REQUIRE(range.Entry == f32(4));
+                REQUIRE(range.Exit == f32(8));
+
+                RayWithInverse<f32> outside(Ray<f32>(Point<f32>(face * f32(1.5), f32(0), f32(-5)), Math::Vector3f(zero, f32(0), f32(1))));
+                REQUIRE_FALSE(SlabIntersection(outside, {}, box));
+            }
+        }
+
+        Box<f32> flat(Point<f32>(f32(0), f32(0), f32(0)), Point<f32>(f32(0), f32(1), f32(1)));
+        RayWithInverse<f32> ray(Ray<f32>(Point<f32>(f32(0), f32(0.5), f32(-1)), Math::Vector3f(f32(0), f32(0), f32(1))));
+        REQUIRE(SlabIntersection(ray, {}, flat).Entry == f32(1));
+        RayWithInverse<f32> through(Ray<f32>(Point<f32>(f32(-1), f32(0.5), f32(0.5)), Math::Vector3f(f32(1), f32(0), f32(0))));
+        REQUIRE(SlabIntersection(through, {}, flat).Entry == f32(1));
+        REQUIRE(SlabIntersection(through, {}, flat).Exit == f32(1));
+    }
+
+    SECTION("One ray against a packet of boxes")
+    {
+        std::vector<Box<f32>> boxes;
+        for (int i = 0; i < 7; ++i)
+        {
+            boxes.emplace_back(random.Point3(f32(6)), random.Point3(f32(6)));
+        }
+        BoxPacket8<f32> packet(std::span<const Box<f32>>(boxes.data(), boxes.size()));
+        REQUIRE(packet.Active[6]);
+        REQUIRE_FALSE(packet.Active[7]);
+
+        int hits = 0;
+        for (int i = 0; i < 500; ++i)
+        {
+            RayWithInverse<f32> ray(Ray<f32>(random.Point3(f32(10)), random.Vector3()));
+            Interval<f32> interval(f32(0), f32(20) * random.Unit());
+            Math::Array<f32, 8> distances = EntryDistances(ray, interval, packet);
+            for (SizeType lane = 0; lane < 7; ++lane)
+            {
+                BoxIntersection<f32> range = SlabIntersection(ray, interval, boxes[Math::ToUnderlying(lane)]);
+                REQUIRE(range.IsValid() == (distances[lane] == distances[lane]));
+                if (range)
+                {
+                    ++hits;
+                    REQUIRE(distances[lane] == range.Entry);
+                }
+            }
+            REQUIRE(distances[7] != distances[7]);
+        }
+        REQUIRE(hits > 100);
+    }
+}
@@ -0,0 +1,155 @@
+#include "GeometryTestsCommon.hpp"
+
+#include <memory>
+#include <vector>
+
+using namespace Math::Types;
+using namespace Math::Geometry;
+
+namespace
+{
+    // Note(3011): Whether p is clearly inside or outside the clip volume,
+    // points close to its border are left out of the comparisons.
+    int ClipSide(const Math::Matrix4f& viewProjection, const Point<f32>& p)
+    {
+        Math::Vector4f clip = viewProjection * Math::Vector4f(p.x, p.y, p.z, f32(1));
+        f32 margin = Math::Min(clip.w - Math::Abs(clip.x), clip.w - Math::Abs(clip.y), Math::Min(clip.z, clip.w - clip.z));
+        if (Math::Abs(margin) < f32(1e-3))
+        {
+            return 0;
+        }
+        return margin > f32(0) ? 1 : -1;
+    }
+}
+
+TEST_CASE("Frustum culling", "[Math][Geometry][Frustum]")
+{
+    RandomGeometry random(Math::u64(89));
+
+    auto projection = Math::PerspectiveProjection(Math::Constant::PiDiv2<f32>, f32(1), f32(1), f32(100));
+
+    SECTION("Planes")
+    {
+        Frustum<f32> frustum(projection);
+        for (SizeType i = 0; i < Frustum<f32>::PlaneCount; ++i)
+        {
+            Math::Vector4f plane = frustum.GetPlane(i);
+            REQUIRE(Math::Equal(Math::Vector3f(plane.x, plane.y, plane.z).Length(), f32(1), f32(1e-6)));
+        }
+
+        REQUIRE(Contains(frustum, Point<f32>(f32(0), f32(0), f32(-10))));
+        REQUIRE(Contains(frustum, Point<f32>(f32(9), f32(-9), f32(-10))));
+        REQUIRE_FALSE(Contains(frustum, Point<f32>(f32(0), f32(0), f32(10))));
+        REQUIRE_FALSE(Contains(frustum, Point<f32>(f32(0), f32(0), f32(-0.5))));
+        REQUIRE_FALSE(Contains(frustum, Point<f32>(f32(0), f32(0), f32(-101))));
+        REQUIRE_FALSE(Contains(frustum, Point<f32>(f32(11), f32(0), f32(-10))));
+        REQUIRE_FALSE(Contains(frustum, Point<f32>(f32(0), f32(11), f32(-10))));
+
+        REQUIRE(Overlaps(frustum, Sphere<f32>(Point<f32>(f32(12), f32(0), f32(-10)), f32(1.5))));
+        REQUIRE_FALSE(Overlaps(frustum, Sphere<f32>(Point<f32>(f32(12), f32(0), f32(-10)), f32(1))));
+        REQUIRE(Overlaps(frustum, Box<f32>(Point<f32>(f32(-1), f32(-1), f32(-1.5)), Point<f32>(f32(1), f32(1), f32(2)))));
+        REQUIRE_FALSE(Overlaps(frustum, Box<f32>(Point<f32>(f32(-1), f32(-1), f32(0)), Point<f32>(f32(1), f32(1), f32(0.5)))));
+        REQUIRE_FALSE(Overlaps(frustum, Box<f32>(Point<f32>(f32(-1), f32(-1), f32(-0.5)), Point<f32>(f32(1), f32(1), f32(2)))));
+    }
+
+    SECTION("Random views")
+    {
+        for (int view = 0; view < 20; ++view)
+        {
+            Math::Transform3f lookAt = Math::LookAt(random.Point3(f32(20)), Math::Vector3f(random.Point3(f32(2))));
+            Math::Matrix4f viewProjection = projection.ToMatrix() * lookAt.ToMatrix();
+            Frustum<f32> frustum(projection, lookAt);
+
+            for (int i = 0; i < 500; ++i)
+            {
+                Point<f32> p = random.Point3(f32(100));
+                int side = ClipSide(viewProjection, p);
+                if (side != 0)
+                {
+                    REQUIRE(Contains(frustum, p) == (side > 0));
+                }
+
+                // Note(3011): The tests may keep shapes that are outside, but
+                // never drop one that has a point inside.
+                Sphere<f32> sphere(random.Point3(f32(100)), random.Unit() * f32(10));
+                Box<f32> box(random.Point3(f32(100)), random.Point3(f32(100)));
+                Point<f32> inSphere = sphere.Center + Math::Vector3f(random.Point3(f32(1))) * sphere.Radius;
+                Point<f32> inBox(box.Min.x + (box.Max.x - box.Min.x) * random.Unit(), box.Min.y + (box.Max.y - box.Min.y) * random.Unit(), box.Min.z + (box.Max.z - box.Min.z) * random.Unit());
+                if (ClipSide(viewProjection, inSphere) > 0 || ClipSide(viewProjection, sphere.Center) > 0)
+                {
+                    REQUIRE(Overlaps(frustum, sphere));
+                }
+                if (ClipSide(viewProjection, inBox) > 0)
+                {
+                    REQUIRE(Overlaps(frustum, box));
+                }
+            }
+        }
+    }
+
+    SECTION("Batches")
+    {
+        Frustum<f32> frustum(projection, Math::LookAt(Point<f32>(f32(1), f32(2), f32(3)), Math::Vector3f(f32(1), f32(0), f32(-1))));
+
+        std::vector<Sphere<f32>> spheres;
+        std::vector<Box<f32>> boxes;
+        for (int i = 0; i < 1001; ++i)
+        {
+            spheres.emplace_back(random.Point3(f32(100)), random.Unit() * f32(5));
+            boxes.emplace_back(random.Point3(f32(100)), random.Point3(f32(100)));
+        }
+        std::span<const Sphere<f32>> sphereSpan(spheres);
+        std::span<const Box<f32>> boxSpan(boxes);
+
+        auto visible = std::make_unique<bool[]>(spheres.size());
+        std::vector<u32> indices(spheres.size());
+
+        Cull(frustum, sphereSpan, std::span<bool>(visible.get(), spheres.size()));
+        SizeType count = Cull(frustum, sphereSpan, std::span<u32>(indices));
+        SizeType next = 0;
+        for (std::size_t i = 0; i < spheres.size(); ++i)
+        {
+            REQUIRE(visible[i] == Overlaps(frustum, spheres[i]));
+            if (visible[i])
+            {
+                REQUIRE(indices[Math::ToUnderlying(next++)] == u32(i));
+            }
+        }
+        REQUIRE(count == next);
+        REQUIRE(count > 0);
+        REQUIRE(count < SizeType(spheres.size()));
+
+        Cull(frustum, boxSpan, std::span<bool>(visible.get(), boxes.size()));
+        count = Cull(frustum, boxSpan, std::span<u32>(indices));
+        next = 0;
+        for (std::size_t i = 0; i < boxes.size(); ++i)
+        {
+            REQUIRE(visible[i] == Overlaps(frustum, boxes[i]));
+            if (visible[i])
+            {
+                REQUIRE(indices[Math::ToUnderlying(next++)] == u32(i));
+            }
+        }
+        REQUIRE(count == next);
+
+        REQUIRE(Cull(frustum, std::span<const Box<f32>>(), std::span<u32>()) == 0);
+
+        // Note(3011): Outputs shorter than the shapes only cover the first
+        // shapes, nothing past their end is written.
+        bool fewVisible[11] = {};
+        fewVisible[10] = true;
+        u32 fewIndices[11] = {};
+        fewIndices[10] = u32(12345);
+        Cull(frustum, sphereSpan, std::span<bool>(fewVisible, 10));
+        count = Cull(frustum, sphereSpan, std::span<u32>(fewIndices, 10));
+        next = 0;
+        for (std::size_t i = 0; i < 10; ++i)
+        {
+            REQUIRE(fewVisible[i] == Overlaps(frustum, spheres[i]));
+            next += fewVisible[i] ? SizeType(1) : SizeType(0);
+        }
+        REQUIRE(count == next);
+        REQUIRE(fewVisible[10]);
+        REQUIRE(fewIndices[10] == u32(12345));
+    }
+}
@@ -0,0 +1,100 @@
+#ifndef MATHLIB_TESTS_GEOMETRY_TESTS_COMMON_HPP
+#define MATHLIB_TESTS_GEOMETRY_TESTS_COMMON_HPP
+
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Geometry.hpp>
+#include <Math/Random.hpp>
+
+// Note(3011): Random points and vectors centered on the origin. The
+// coordinates are drawn in the order x, y, z.
+class RandomGeometry final
+{
+public:
+    explicit
+    RandomGeometry(Math::u64 seed)
+        : mRng(seed)
+    {}
+
+    Math::f32 Unit()
+    {
+        return mDistribution(mRng);
+    }
+
+    Math::Point2f Point2(Math::f32 size)
+    {
+        Math::f32 x = Centered(size);
+        Math::f32 y = Centered(size);
+        return Math::Point2f(x, y);
+    }
+
+    Math::Point3f Point3(Math::f32 size)
+    {
+        Math::f32 x = Centered(size);
+        Math::f32 y = Centered(size);
+        Math::f32 z = Centered(size);
+        return Math::Point3f(x, y, z);
+    }
+
+    // Note(3011): Not normalized, each component is in [-0.5, 0.5).
+    Math::Vector3f Vector3()
+    {
+        Math::f32 x = Centered(Math::f32(1));
+        Math::f32 y = Centered(Math::f32(1));
+        Math::f32 z = Centered(Math::f32(1));
+        return Math::Vector3f(x, y, z);
+    }
+private:
+    Math::f32 Centered(Math::f32 size)
+    {
+        return (Unit() - Math::f32(0.5)) * size;
+    }
+
+    Math::Random64 mRng;
+    Math::UniformUnitDistribution<Math::f32> mDistribution;
+};
+
+// Note(3011): Bitwise the same result, where two NaNs count as the same.
+inline bool Same(Math::f32 a, Math::f32 b)
+{
+    return (a != a && b != b) || a == b;
+}
+
+inline bool Same(const Math::Point3f& a, const Math::Point3f& b)
+{
+    return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+inline bool Same(const Math::Geometry::Box<Math::f32>& a, const Math::Geometry::Box<Math::f32>& b)
+{
+    return Same(a.Min, b.Min) && Same(a.Max, b.Max);
+}
+
+inline bool Near(const Math::Geometry::Box<Math::f32>& a, const Math::Geometry::Box<Math::f32>& b, Math::f32 tolerance = Math::f32(1e-4))
+{
+    return Math::Equal(a.Min.x, b.Min.x, tolerance) && Math::Equal(a.Min.y, b.Min.y, tolerance) && Math::Equal(a.Min.z, b.Min.z, tolerance) &&
+           Math::Equal(a.Max.x, b.Max.x, tolerance) && Math::Equal(a.Max.y, b.Max.y, tolerance) && Math::Equal(a.Max.z, b.Max.z, tolerance);
+}
+
+// Note(3011): Every lane of the packet against the single ray version.
+template <typename Packet, typename Shape>
+void RequireNearestLanesMatch(const Packet& packet, const Shape& shape)
+{
+    auto distances = Math::Geometry::NearestIntersection(packet, shape);
+    for (Math::SizeType lane = 0; lane < Packet::Width; ++lane)
+    {
+        Math::f32 expected = Math::Geometry::NearestIntersection(packet.GetRay(lane), packet.GetInterval(lane), shape).Distance;
+        REQUIRE(Same(distances[lane], expected));
+    }
+}
+
+template <typename Packet, typename Shape>
+void RequireAnyLanesMatch(const Packet& packet, const Shape& shape)
+{
+    auto hits = Math::Geometry::AnyIntersection(packet, shape);
+    for (Math::SizeType lane = 0; lane < Packet::Width; ++lane)
+    {
+        REQUIRE(hits[lane] == (packet.Active[lane] && Math::Geometry::AnyIntersection(packet.GetRay(lane), packet.GetInterval(lane), shape)));
+    }
+}
+
+#endif //MATHLIB_TESTS_GEOMETRY_TESTS_COMMON_HPP
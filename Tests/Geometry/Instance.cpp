@@ -0,0 +1,167 @@
+#include "GeometryTestsCommon.hpp"
+
+#include <vector>
+
+using namespace Math::Types;
+using namespace Math::Geometry;
+
+namespace
+{
+    // Note(3011): A BVH together with the mesh it indexes, placed as one
+    // shape through its members.
+    struct MeshTree
+    {
+        TriangleMesh<f32>::Hit NearestIntersection(const Ray<f32>& ray, const Interval<f32>& interval) const noexcept
+        {
+            return Math::Geometry::NearestIntersection(ray, interval, Tree, Mesh);
+        }
+
+        Box<f32> Bounds() const noexcept
+        {
+            return Mesh.Bounds();
+        }
+
+        TriangleMesh<f32> Mesh;
+        BVH<f32> Tree;
+    };
+}
+
+TEST_CASE("Instanced shapes", "[Math][Geometry][Instance]")
+{
+    RandomGeometry random(Math::u64(97));
+    auto transform = [&](bool uniform)
+    {
+        f32 scale = f32(0.5) + random.Unit();
+        Math::Vector3f scales = uniform ? Math::Vector3f(scale) : Math::Vector3f(f32(0.5) + random.Unit(), f32(0.5) + random.Unit(), f32(0.5) + random.Unit());
+        return Math::Translate(random.Vector3() * f32(4)) * Math::RotateY(random.Unit() * f32(6)) * Math::RotateX(random.Unit() * f32(6)) * Math::Scale(scales);
+    };
+
+    SECTION("Spheres")
+    {
+        Sphere<f32> unit(Point<f32>(f32(0.5), f32(0), f32(-0.25)), f32(1));
+        for (int i = 0; i < 1000; ++i)
+        {
+            Math::Transform3f t = transform(true);
+            Instance<f32, Sphere<f32>> instance(unit, t);
+            f32 scale = (t * Math::Vector3f(f32(1), f32(0), f32(0))).Length();
+            Sphere<f32> world(t * unit.Center, scale);
+
+            Ray<f32> ray(random.Point3(f32(10)), random.Vector3());
+            Intersection<f32> expected = NearestIntersection(ray, {}, world);
+            Intersection<f32> hit = NearestIntersection(ray, {}, instance);
+            REQUIRE(AnyIntersection(ray, {}, instance) == hit.IsValid());
+            if (expected && hit)
+            {
+                REQUIRE(Math::Equal(hit.Distance, expected.Distance, f32(1e-3)));
+                Point<f32> p = ray.Project(hit.Distance);
+                REQUIRE(Math::Equal(instance.SurfaceNormal(p), world.SurfaceNormal(p), f32(1e-3)));
+            }
+        }
+    }
+
+    SECTION("Triangles under non uniform scaling")
+    {
+        int hits = 0;
+        for (int i = 0; i < 1000; ++i)
+        {
+            Math::Transform3f t = transform(false);
+            Triangle<f32> triangle(random.Point3(f32(2)), random.Point3(f32(2)), random.Point3(f32(2)));
+            Instance<f32, Triangle<f32>> instance(triangle, t);
+            Triangle<f32> world(t * triangle.A, t * triangle.B, t * triangle.C);
+
+            Point<f32> target = world.A + (world.B - world.A) * random.Unit() * f32(0.5) + (world.C - world.A) * random.Unit() * f32(0.5);
+            Point<f32> origin = random.Point3(f32(10));
+            Ray<f32> ray(origin, target - origin);
+            TriangleIntersection<f32> expected = MollerTrumboreIntersection(ray, {}, world);
+            TriangleIntersection<f32> hit = MollerTrumboreIntersection(instance.ToObjectSpace(ray), {}, triangle);
+            REQUIRE(AnyIntersection(ray, {}, instance) == NearestIntersection(ray, {}, instance).IsValid());
+            if (expected && hit)
+            {
+                ++hits;
+                REQUIRE(Math::Equal(hit.Distance, expected.Distance, f32(1e-3) * Math::Max(f32(1), expected.Distance)));
+                Point<f32> p = ray.Project(hit.Distance);
+                REQUIRE(Math::Equal(instance.SurfaceNormal(p), Math::Normalize(world.SurfaceNormal(p)), f32(1e-3)));
+            }
+        }
+        REQUIRE(hits > 100);
+    }
+
+    SECTION("Meshes and trees")
+    {
+        std::vector<Point<f32>> vertices;
+        std::vector<u32> indices;
+        for (u32 i = 0; i < 60; ++i)
+        {
+            Point<f32> base = random.Point3(f32(6));
+            vertices.push_back(base);
+            vertices.push_back(base + random.Vector3());
+            vertices.push_back(base + random.Vector3());
+            indices.insert(indices.end(), { i * u32(3), i * u32(3) + u32(1), i * u32(3) + u32(2) });
+        }
+        std::span<const Point<f32>> vertexSpan(vertices);
+        std::span<const u32> indexSpan(indices);
+        TriangleMesh<f32> mesh(vertexSpan, indexSpan);
+        std::vector<Box<f32>> bounds = mesh.TriangleBounds();
+        MeshTree tree{ mesh, BVH<f32>(std::span<const Box<f32>>(bounds)) };
+
+        std::vector<Instance<f32, MeshTree>> instances;
+        std::vector<Instance<f32, TriangleMesh<f32>>> meshes;
+        for (int i = 0; i < 20; ++i)
+        {
+            Math::Transform3f t = Math::Translate(random.Vector3() * f32(40)) * Math::RotateZ(random.Unit() * f32(6)) * Math::Scale(Math::Vector3f(f32(0.5) + random.Unit(), f32(1), f32(2)));
+            instances.emplace_back(tree, t);
+            meshes.emplace_back(mesh, t);
+        }
+        std::span<const Instance<f32, MeshTree>> instanceSpan(instances);
+        BVH<f32> top(instanceSpan);
+
+        int hits = 0;
+        for (int i = 0; i < 500; ++i)
+        {
+            Point<f32> origin = random.Point3(f32(50));
+            Point<f32> target = instances[Math::ToUnderlying(SizeType(i) % SizeType(instances.size()))].ToWorldSpace(vertices[std::size_t(i) % vertices.size()]);
+            Ray<f32> ray(origin, target - origin + random.Vector3() * f32(0.2));
+
+            TriangleMesh<f32>::Hit expected;
+            SizeType expectedInstance = 0;
+            for (SizeType j = 0; j < SizeType(meshes.size()); ++j)
+            {
+                TriangleMesh<f32>::Hit hit = NearestIntersection(ray, {}, meshes[Math::ToUnderlying(j)]);
+                REQUIRE(AnyIntersection(ray, {}, meshes[Math::ToUnderlying(j)]) == hit.IsValid());
+                if (hit && (!expected || hit.Distance < expected.Distance))
+                {
+                    expected = hit;
+                    expectedInstance = j;
+                }
+            }
+
+            BVH<f32>::Hit hit = top.NearestIntersection(ray, {}, [&](SizeType index, const Ray<f32>& r, const Interval<f32>& interval)
+            {
+                return Intersection<f32>(NearestIntersection(r, interval, instances[Math::ToUnderlying(index)]));
+            });
+            REQUIRE(hit.IsValid() == expected.IsValid());
+            REQUIRE(HasIntersection(ray, {}, top, instanceSpan) == expected.IsValid());
+            if (hit)
+            {
+                ++hits;
+                REQUIRE(hit.Distance == expected.Distance);
+                REQUIRE(hit.Index == expectedInstance);
+                REQUIRE(NearestIntersection(ray, {}, instances[Math::ToUnderlying(hit.Index)]).Index == expected.Index);
+            }
+        }
+        REQUIRE(hits > 100);
+    }
+
+    SECTION("Bounds")
+    {
+        Plane<f32> plane(Point<f32>(f32(0)), Math::Vector3f(f32(0), f32(1), f32(0)));
+        Box<f32> planeBounds = BoundingBox(Instance<f32, Plane<f32>>(plane, transform(false)));
+        REQUIRE(planeBounds.Max.x == f32::Infinity());
+        REQUIRE(planeBounds.Min.y == -f32::Infinity());
+
+        Sphere<f32> sphere(Point<f32>(f32(1), f32(2), f32(3)), f32(1));
+        Box<f32> moved = BoundingBox(Instance<f32, Sphere<f32>>(sphere, Math::Translate(Math::Vector3f(f32(-1), f32(0), f32(1)))));
+        REQUIRE(moved.Min.x == f32(-1));
+        REQUIRE(moved.Max.z == f32(5));
+    }
+}
@@ -0,0 +1,97 @@
+#include "GeometryTestsCommon.hpp"
+
+#include <vector>
+
+using namespace Math::Types;
+using namespace Math::Geometry;
+
+TEST_CASE("Ray packets", "[Math][Geometry][RayPacket]")
+{
+    RandomGeometry random(Math::u64(59));
+
+    SECTION("Lanes match single rays")
+    {
+        int hits = 0;
+        for (int i = 0; i < 500; ++i)
+        {
+            // Note(3011): Rays fanning out from one point, as primary rays do.
+            Point<f32> origin = random.Point3(f32(4));
+            Math::Vector3f forward = Math::Normalize(random.Vector3());
+            RayPacket8<f32> packet;
+            for (SizeType lane = 0; lane < 8; ++lane)
+            {
+                f32 min = lane == 3 ? f32(1) : Math::Constant::GeometryEpsilon<f32>;
+                packet.Set(lane, Ray<f32>(origin, forward + random.Vector3() * f32(0.5)), Interval<f32>(min, f32(20)));
+            }
+
+            Sphere<f32> sphere(random.Point3(f32(4)), f32(0.5) + random.Unit());
+            Triangle<f32> triangle(random.Point3(f32(6)), random.Point3(f32(6)), random.Point3(f32(6)));
+            Plane<f32> plane(random.Point3(f32(4)), Math::Normalize(random.Vector3()));
+            RequireNearestLanesMatch(packet, sphere);
+            RequireNearestLanesMatch(packet, triangle);
+            RequireNearestLanesMatch(packet, plane);
+            RequireNearestLanesMatch(packet, Box<f32>(random.Point3(f32(6)), random.Point3(f32(6))));
+
+            Math::Array<f32, 8> distances = NearestIntersection(packet, sphere);
+            for (SizeType lane = 0; lane < 8; ++lane)
+            {
+                hits += distances[lane] == distances[lane] ? 1 : 0;
+            }
+        }
+        REQUIRE(hits > 200);
+    }
+
+    SECTION("Inactive lanes miss")
+    {
+        std::vector<Ray<f32>> rays(3, Ray<f32>(Point<f32>(f32(0), f32(0), f32(-5)), Math::Vector3f(f32(0), f32(0), f32(1))));
+        RayPacket4<f32> packet(std::span<const Ray<f32>>(rays.data(), rays.size()));
+        REQUIRE(packet.AnyActive());
+        REQUIRE(packet.Active[2]);
+        REQUIRE_FALSE(packet.Active[3]);
+
+        Math::Array<f32, 4> distances = NearestIntersection(packet, Sphere<f32>(Point<f32>(f32(0), f32(0), f32(0)), f32(1)));
+        REQUIRE(distances[0] == f32(4));
+        REQUIRE(distances[2] == f32(4));
+        REQUIRE(distances[3] != distances[3]);
+
+        REQUIRE_FALSE(RayPacket4<f32>().AnyActive());
+    }
+
+    SECTION("Boxes")
+    {
+        Box<f32> box(Point<f32>(f32(-1), f32(-1), f32(-1)), Point<f32>(f32(1), f32(2), f32(3)));
+        RayPacket4<f32> packet;
+        packet.Set(0, Ray<f32>(Point<f32>(f32(0), f32(0), f32(-5)), Math::Vector3f(f32(0), f32(0), f32(1))));
+        packet.Set(1, Ray<f32>(Point<f32>(f32(0), f32(0), f32(0)), Math::Vector3f(f32(0), f32(0.5), f32(0))));
+        packet.Set(2, Ray<f32>(Point<f32>(f32(-3), f32(0), f32(0)), Math::Vector3f(f32(0), f32(1), f32(0))));
+        packet.Set(3, Ray<f32>(Point<f32>(f32(-1), f32(0), f32(-5)), Math::Vector3f(f32(0), f32(0), f32(2))), Interval<f32>(f32(0), f32(1)));
+
+        Math::Array<f32, 4> distances = NearestIntersection(packet, box);
+        REQUIRE(distances[0] == f32(4));
+        REQUIRE(distances[1] == f32(4));
+        REQUIRE(distances[2] != distances[2]);
+        REQUIRE(distances[3] != distances[3]);
+
+        // Note(3011): Along the face x = -1, parallel to the x slab.
+        packet.IntervalMax[3] = f32::Max();
+        REQUIRE(NearestIntersection(packet, box)[3] == f32(2));
+
+        for (int i = 0; i < 500; ++i)
+        {
+            for (SizeType lane = 0; lane < 4; ++lane)
+            {
+                packet.Set(lane, Ray<f32>(random.Point3(f32(8)), random.Vector3()));
+            }
+            distances = NearestIntersection(packet, box);
+            for (SizeType lane = 0; lane < 4; ++lane)
+            {
+                if (distances[lane] == distances[lane])
+                {
+                    Point<f32> hit = packet.GetRay(lane).Project(distances[lane]);
+                    f32 outside = Math::Max(box.Min.x - hit.x, hit.x - box.Max.x, box.Min.y - hit.y, hit.y - box.Max.y, box.Min.z - hit.z, hit.z - box.Max.z);
+                    REQUIRE(Math::Abs(outside) < f32(1e-4));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,172 @@
+#include "GeometryTestsCommon.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using namespace Math::Types;
+using namespace Math::Geometry;
+
+namespace
+{
+    template <typename PointType>
+    std::vector<u32> BruteRadius(const std::vector<PointType>& points, const PointType& center, typename PointType::ScalarType radius)
+    {
+        std::vector<u32> result;
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            if ((points[i] - center).LenSqr() <= radius * radius)
+            {
+                result.push_back(u32(i));
+            }
+        }
+        return result;
+    }
+
+    template <typename Structure, typename PointType>
+    void Check(const Structure& structure, const std::vector<PointType>& points, const PointType& center, typename PointType::ScalarType radius, SizeType k)
+    {
+        std::vector<u32> found;
+        structure.ForEachInRadius(center, radius, [&](const PointType& point, u32 index)
+        {
+            REQUIRE((point - points[Math::ToUnderlying(index)]).LenSqr() == typename PointType::ScalarType(0));
+            found.push_back(index);
+        });
+        std::sort(found.begin(), found.end());
+        REQUIRE(found == BruteRadius(points, center, radius));
+
+        std::vector<typename PointType::ScalarType> distances;
+        for (const PointType& point : points)
+        {
+            distances.push_back((point - center).LenSqr());
+        }
+        std::sort(distances.begin(), distances.end());
+
+        auto nearest = structure.Nearest(center, k);
+        REQUIRE(nearest.size() == Math::Min(std::size_t(Math::ToUnderlying(k)), points.size()));
+        for (std::size_t i = 0; i < nearest.size(); ++i)
+        {
+            REQUIRE(nearest[i].DistanceSquared == distances[i]);
+            REQUIRE(nearest[i].DistanceSquared == (points[Math::ToUnderlying(nearest[i].Value)] - center).LenSqr());
+        }
+    }
+}
+
+TEST_CASE("Uniform grids and spatial hashes", "[Math][Geometry][SpatialHash]")
+{
+    RandomGeometry random(Math::u64(101));
+
+    SECTION("3D")
+    {
+        UniformGrid<Math::Point3f> grid(Math::Point3f(f32(-10)), Math::Point3f(f32(10)), f32(1.5));
+        SpatialHash<Math::Point3f> hash(f32(1.5));
+        REQUIRE(grid.Resolution()[0] == 14);
+
+        for (int frame = 0; frame < 3; ++frame)
+        {
+            // Note(3011): Some points lie outside of the grid.
+            std::vector<Math::Point3f> points;
+            for (int i = 0; i < 2000; ++i)
+            {
+                points.push_back(random.Point3(f32(24)));
+            }
+            std::span<const Math::Point3f> span(points);
+            grid.Build(span);
+            hash.Build(span);
+            REQUIRE(grid.Count() == 2000);
+            REQUIRE(hash.BucketCount() == 2048);
+
+            for (int i = 0; i < 100; ++i)
+            {
+                Math::Point3f center = random.Point3(f32(30));
+                f32 radius = random.Unit() * f32(4);
+                SizeType k = SizeType(1) + SizeType(i % 20);
+                Check(grid, points, center, radius, k);
+                Check(hash, points, center, radius, k);
+            }
+            Check(hash, points, Math::Point3f(f32(0)), f32(1000), SizeType(3));
+            Check(grid, points, Math::Point3f(f32(100)), f32(5), SizeType(3));
+        }
+    }
+
+    SECTION("2D")
+    {
+        UniformGrid<Math::Point2f> grid(Math::Point2f(f32(0)), Math::Point2f(f32(20), f32(10)), f32(0.5));
+        SpatialHash<Math::Point2f> hash(f32(0.25));
+        REQUIRE(grid.Resolution()[0] == 40);
+        REQUIRE(grid.Resolution()[1] == 20);
+
+        std::vector<Math::Point2f> points;
+        for (int i = 0; i < 3000; ++i)
+        {
+            points.push_back(Math::Point2f(f32(10), f32(5)) + Math::Vector2f(random.Point2(f32(22))));
+        }
+        std::span<const Math::Point2f> span(points);
+        grid.Build(span);
+        hash.Build(span);
+
+        for (int i = 0; i < 200; ++i)
+        {
+            Math::Point2f center = Math::Point2f(f32(10), f32(5)) + Math::Vector2f(random.Point2(f32(26)));
+            f32 radius = random.Unit() * f32(3);
+            Check(grid, points, center, radius, SizeType(1) + SizeType(i % 30));
+            Check(hash, points, center, radius, SizeType(1) + SizeType(i % 30));
+        }
+        Check(grid, points, Math::Point2f(f32(5)), f32(1), SizeType(5000));
+    }
+
+    SECTION("Payloads and empty structures")
+    {
+        std::vector<Math::Point2f> points = { Math::Point2f(f32(0), f32(0)), Math::Point2f(f32(1), f32(0)), Math::Point2f(f32(0), f32(3)) };
+        std::vector<f32> masses = { f32(1), f32(2), f32(3) };
+        SpatialHash<Math::Point2f, f32> hash(f32(1));
+        hash.Build(std::span<const Math::Point2f>(points), std::span<const f32>(masses));
+
+        f32 total = f32(0);
+        hash.ForEachInRadius(Math::Point2f(f32(0.5), f32(0)), f32(1), [&](const Math::Point2f&, f32 mass) { total += mass; });
+        REQUIRE(total == f32(3));
+
+        auto nearest = hash.Nearest(Math::Point2f(f32(0), f32(2)), SizeType(2));
+        REQUIRE(nearest.size() == 2);
+        REQUIRE(nearest[0].Value == f32(3));
+        REQUIRE(nearest[1].Value == f32(1));
+        REQUIRE(nearest[1].DistanceSquared == f32(4));
+
+        // Note(3011): A point without a payload is left out.
+        hash.Build(std::span<const Math::Point2f>(points), std::span<const f32>(masses.data(), 2));
+        REQUIRE(hash.Count() == 2);
+        UniformGrid<Math::Point2f, f32> plane(Math::Point2f(f32(0)), Math::Point2f(f32(4)), f32(1));
+        plane.Build(std::span<const Math::Point2f>(points), std::span<const f32>(masses.data(), 1));
+        REQUIRE(plane.Count() == 1);
+        REQUIRE(plane.Nearest(Math::Point2f(f32(0), f32(3)), SizeType(3)).size() == 1);
+
+        UniformGrid<Math::Point3f> grid(Math::Point3f(f32(0)), Math::Point3f(f32(1)), f32(0.1));
+        REQUIRE(grid.Nearest(Math::Point3f(f32(0)), SizeType(3)).empty());
+        grid.Build(std::span<const Math::Point3f>());
+        REQUIRE(grid.Count() == 0);
+        REQUIRE(grid.Nearest(Math::Point3f(f32(0)), SizeType(3)).empty());
+        REQUIRE(SpatialHash<Math::Point3f>(f32(1)).Nearest(Math::Point3f(f32(0)), SizeType(3)).empty());
+    }
+
+    SECTION("Default and oversized grids stay usable")
+    {
+        std::vector<Math::Point3f> points;
+        for (int i = 0; i < 200; ++i)
+        {
+            points.push_back(random.Point3(f32(4)));
+        }
+
+        UniformGrid<Math::Point3f> single;
+        REQUIRE(single.Resolution()[0] == 1);
+        REQUIRE(single.Resolution()[2] == 1);
+        single.Build(points);
+        REQUIRE(single.Count() == 200);
+        REQUIRE(single.Nearest(Math::Point3f(f32(0)), SizeType(5)).size() == 5);
+
+        UniformGrid<Math::Point3f> fine(Math::Point3f(f32(-2)), Math::Point3f(f32(2)), f32(1e-6));
+        REQUIRE(fine.Resolution()[0] == UniformGrid<Math::Point3f>::MaxResolution);
+        REQUIRE(fine.Resolution()[1] == UniformGrid<Math::Point3f>::MaxResolution);
+        fine.Build(points);
+
+        Check(fine, points, Math::Point3f(f32(0.5), f32(-0.25), f32(1)), f32(1.5), SizeType(7));
+    }
+}
@@ -0,0 +1,119 @@
+#include "GeometryTestsCommon.hpp"
+
+#include <vector>
+
+using namespace Math::Types;
+using namespace Math::Geometry;
+
+namespace
+{
+    // Note(3011): The nearer root in double precision, as the reference.
+    f64 Reference(const Ray<f32>& ray, const Sphere<f32>& sphere)
+    {
+        Math::Vector3d f(Math::Cast<f64>(ray.Origin.x - sphere.Center.x), Math::Cast<f64>(ray.Origin.y - sphere.Center.y), Math::Cast<f64>(ray.Origin.z - sphere.Center.z));
+        Math::Vector3d d(Math::Cast<f64>(ray.Direction.x), Math::Cast<f64>(ray.Direction.y), Math::Cast<f64>(ray.Direction.z));
+        f64 a = Math::Dot(d, d);
+        f64 b = Math::Dot(f, d);
+        f64 c = Math::Dot(f, f) - Math::Squared(Math::Cast<f64>(sphere.Radius));
+        return (-b - Math::Sqrt(b * b - a * c)) / a;
+    }
+}
+
+TEST_CASE("Ray sphere intersections", "[Math][Geometry][Sphere]")
+{
+    RandomGeometry random(Math::u64(79));
+
+    SECTION("Small spheres far away")
+    {
+        // Note(3011): With b^2 - ac, the discriminant of these cancels down
+        // to a few bits, the hits land visibly off the surface.
+        int hits = 0;
+        for (int i = 0; i < 1000; ++i)
+        {
+            Sphere<f32> sphere(Point<f32>(f32(0), f32(0), f32(0)) + random.Vector3() * f32(10), f32(0.01));
+            Point<f32> origin(f32(2000) + random.Unit(), random.Unit() * f32(10), f32(-3000));
+            Point<f32> target = sphere.Center + random.Vector3() * f32(0.015);
+            Ray<f32> ray(origin, (target - origin) * (f32(0.5) + random.Unit()));
+
+            Intersection<f32> hit = NearestIntersection(ray, {}, sphere);
+            f64 reference = Reference(ray, sphere);
+            REQUIRE(hit.IsValid() == (reference == reference));
+            if (hit)
+            {
+                ++hits;
+                REQUIRE(Math::Abs(Math::Cast<f64>(hit.Distance) - reference) < reference * f64(1e-6));
+            }
+        }
+        REQUIRE(hits > 300);
+    }
+
+    SECTION("Normalized directions")
+    {
+        for (int i = 0; i < 2000; ++i)
+        {
+            Sphere<f32> sphere(random.Point3(f32(4)), f32(0.2) + random.Unit());
+            UnitRay<f32> ray(Ray<f32>(random.Point3(f32(8)), random.Vector3()));
+            REQUIRE(Math::Equal(ray.Direction.Length(), f32(1), f32(1e-6)));
+
+            Intersection<f32> unit = NearestIntersection(ray, {}, sphere);
+            Intersection<f32> general = NearestIntersection(static_cast<const Ray<f32>&>(ray), {}, sphere);
+            REQUIRE(unit.IsValid() == general.IsValid());
+            if (unit)
+            {
+                REQUIRE(Math::Equal(unit.Distance, general.Distance, f32(1e-4)));
+            }
+        }
+
+        Sphere<f32> sphere(Point<f32>(f32(0), f32(0), f32(0)), f32(1));
+        UnitRay<f32> inside(Ray<f32>(Point<f32>(f32(0), f32(0), f32(0)), Math::Vector3f(f32(0), f32(3), f32(0))));
+        REQUIRE(NearestIntersection(inside, {}, sphere).Distance == f32(1));
+        UnitRay<f32> outside(Ray<f32>(Point<f32>(f32(0), f32(0), f32(-3)), Math::Vector3f(f32(0), f32(0), f32(2))));
+        REQUIRE(NearestIntersection(outside, {}, sphere).Distance == f32(2));
+        REQUIRE(NearestIntersection(outside, Interval<f32>(f32(2.5), f32(9)), sphere).Distance == f32(4));
+        REQUIRE_FALSE(NearestIntersection(outside, Interval<f32>(f32(0), f32(1)), sphere));
+    }
+
+    SECTION("Sets of spheres")
+    {
+        std::vector<Sphere<f32>> spheres;
+        for (int i = 0; i < 61; ++i)
+        {
+            spheres.emplace_back(random.Point3(f32(10)), f32(0.1) + random.Unit() * f32(0.5));
+        }
+        SphereSet<f32> set{ std::span<const Sphere<f32>>(spheres) };
+        REQUIRE(set.Count() == 61);
+        REQUIRE(set.GetSphere(60).Radius == spheres[60].Radius);
+        REQUIRE(set.Bounds().size() == 61);
+
+        int hits = 0;
+        for (int i = 0; i < 1000; ++i)
+        {
+            Ray<f32> ray(random.Point3(f32(12)), random.Vector3());
+            Interval<f32> interval = random.Unit() < f32(0.5) ? Interval<f32>() : Interval<f32>(f32(1), f32(5));
+
+            SphereSet<f32>::Hit expected;
+            for (SizeType s = 0; s < 61; ++s)
+            {
+                Intersection<f32> hit = NearestIntersection(ray, interval, spheres[Math::ToUnderlying(s)]);
+                if (hit && (!expected || hit.Distance < expected.Distance))
+                {
+                    expected = SphereSet<f32>::Hit(hit.Distance, s);
+                }
+            }
+
+            SphereSet<f32>::Hit hit = set.NearestIntersection(ray, interval);
+            REQUIRE(Same(hit.Distance, expected.Distance));
+            REQUIRE(set.HasIntersection(ray, interval) == expected.IsValid());
+            if (hit)
+            {
+                ++hits;
+                REQUIRE(hit.Index == expected.Index);
+            }
+
+            UnitRay<f32> unit(ray);
+            REQUIRE(set.NearestIntersection(unit, interval).IsValid() == set.HasIntersection(unit, interval));
+        }
+        REQUIRE(hits > 50);
+        REQUIRE_FALSE(SphereSet<f32>().NearestIntersection(Ray<f32>(random.Point3(f32(1)), random.Vector3()), {}));
+    }
+}
@@ -0,0 +1,118 @@
+#include "GeometryTestsCommon.hpp"
+
+using namespace Math::Types;
+using namespace Math::Geometry;
+
+TEST_CASE("Triangle intersections with barycentrics", "[Math][Geometry][Triangle]")
+{
+    RandomGeometry random(Math::u64(61));
+
+    SECTION("All variants agree with the plane and project test")
+    {
+        int hits = 0;
+        for (int i = 0; i < 5000; ++i)
+        {
+            Triangle<f32> triangle(random.Point3(f32(4)), random.Point3(f32(4)), random.Point3(f32(4)));
+            Point<f32> origin = random.Point3(f32(10));
+            Ray<f32> ray(origin, random.Point3(f32(2)) - origin);
+
+            Intersection<f32> expected = NearestIntersection(ray, {}, triangle);
+            TriangleIntersection<f32> moller = MollerTrumboreIntersection(ray, {}, triangle);
+            TriangleIntersection<f32> watertight = WatertightIntersection(ray, {}, triangle);
+            TriangleIntersection<f32> precomputed = NearestIntersection(ray, {}, PrecomputedTriangle<f32>(triangle));
+
+            // Note(3011): Rays grazing an edge may be decided either way.
+            if (moller.IsValid() != expected.IsValid())
+            {
+                REQUIRE((Math::Min(moller.U, moller.V) < f32(1e-3) || moller.U + moller.V > f32(0.999)));
+                continue;
+            }
+            REQUIRE(watertight.IsValid() == moller.IsValid());
+            REQUIRE(precomputed.IsValid() == moller.IsValid());
+            if (!moller)
+            {
+                continue;
+            }
+
+            ++hits;
+            f32 tolerance = f32(1e-3) * Math::Max(f32(1), expected.Distance);
+            REQUIRE(Math::Equal(moller.Distance, expected.Distance, tolerance));
+            REQUIRE(Math::Equal(watertight.Distance, expected.Distance, tolerance));
+            REQUIRE(Math::Equal(precomputed.Distance, expected.Distance, tolerance));
+            REQUIRE(Math::Equal(watertight.U, moller.U, f32(1e-3)));
+            REQUIRE(Math::Equal(watertight.V, moller.V, f32(1e-3)));
+            REQUIRE(Math::Equal(precomputed.U, moller.U, f32(1e-3)));
+            REQUIRE(Math::Equal(precomputed.V, moller.V, f32(1e-3)));
+
+            Point<f32> hit = ray.Project(moller.Distance);
+            Point<f32> barycentric = triangle.A + moller.U * (triangle.B - triangle.A) + moller.V * (triangle.C - triangle.A);
+            REQUIRE(Math::Equal(hit.x, barycentric.x, f32(1e-2)));
+            REQUIRE(Math::Equal(hit.y, barycentric.y, f32(1e-2)));
+            REQUIRE(Math::Equal(hit.z, barycentric.z, f32(1e-2)));
+        }
+        REQUIRE(hits > 500);
+    }
+
+    SECTION("Vertices and intervals")
+    {
+        Triangle<f32> triangle(Point<f32>(f32(0), f32(0), f32(2)), Point<f32>(f32(1), f32(0), f32(2)), Point<f32>(f32(0), f32(1), f32(2)));
+        Ray<f32> ray(Point<f32>(f32(1), f32(0), f32(0)), Math::Vector3f(f32(0), f32(0), f32(1)));
+
+        TriangleIntersection<f32> hit = WatertightIntersection(ray, {}, triangle);
+        REQUIRE(hit);
+        REQUIRE(hit.Distance == f32(2));
+        REQUIRE(hit.U == f32(1));
+        REQUIRE(hit.V == f32(0));
+
+        hit = MollerTrumboreIntersection(ray, {}, triangle);
+        REQUIRE(hit.Distance == f32(2));
+        REQUIRE(hit.U == f32(1));
+
+        REQUIRE_FALSE(MollerTrumboreIntersection(ray, Interval<f32>(f32(0), f32(1)), triangle));
+        REQUIRE_FALSE(WatertightIntersection(ray, Interval<f32>(f32(0), f32(1)), triangle));
+        REQUIRE_FALSE(NearestIntersection(ray, Interval<f32>(f32(0), f32(1)), PrecomputedTriangle<f32>(triangle)));
+
+        Ray<f32> backwards(Point<f32>(f32(0.2), f32(0.2), f32(3)), Math::Vector3f(f32(0), f32(0), f32(1)));
+        REQUIRE_FALSE(MollerTrumboreIntersection(backwards, {}, triangle));
+        REQUIRE_FALSE(WatertightIntersection(backwards, {}, triangle));
+        REQUIRE_FALSE(NearestIntersection(backwards, {}, PrecomputedTriangle<f32>(triangle)));
+
+        Ray<f32> coplanar(Point<f32>(f32(-1), f32(0.2), f32(2)), Math::Vector3f(f32(1), f32(0), f32(0)));
+        REQUIRE_FALSE(MollerTrumboreIntersection(coplanar, {}, triangle));
+        REQUIRE_FALSE(WatertightIntersection(coplanar, {}, triangle));
+        REQUIRE_FALSE(NearestIntersection(coplanar, {}, PrecomputedTriangle<f32>(triangle)));
+
+        Triangle<f32> degenerate(triangle.A, triangle.B, triangle.A + (triangle.B - triangle.A) * f32(2));
+        REQUIRE_FALSE(MollerTrumboreIntersection(ray, {}, degenerate));
+        REQUIRE_FALSE(WatertightIntersection(ray, {}, degenerate));
+    }
+
+    SECTION("No ray falls between triangles sharing an edge")
+    {
+        for (int i = 0; i < 2000; ++i)
+        {
+            Point<f32> a = random.Point3(f32(4));
+            Point<f32> b = random.Point3(f32(4));
+            Point<f32> c = random.Point3(f32(4));
+            Point<f32> d = random.Point3(f32(4));
+            Triangle<f32> first(a, b, c);
+            Triangle<f32> second(b, a, d);
+
+            // Note(3011): Aimed at a point of the shared edge, which rounding
+            // puts on either side of it.
+            f32 along = random.Unit();
+            Point<f32> target = a + along * (b - a);
+            Point<f32> origin = random.Point3(f32(10));
+            Ray<f32> ray(origin, target - origin);
+
+            // Note(3011): Only when c and d are on opposite sides of the
+            // edge as seen from the ray, the two triangles cover it.
+            Math::Vector3f normal = Math::Cross(b - a, ray.Direction);
+            bool covered = (Math::Dot(normal, c - a) > f32(0)) != (Math::Dot(normal, d - a) > f32(0));
+            if (covered)
+            {
+                REQUIRE((WatertightIntersection(ray, {}, first) || WatertightIntersection(ray, {}, second)));
+            }
+        }
+    }
+}
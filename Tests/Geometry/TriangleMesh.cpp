@@ -0,0 +1,112 @@
+#include "GeometryTestsCommon.hpp"
+
+#include <vector>
+
+using namespace Math::Types;
+using namespace Math::Geometry;
+
+TEST_CASE("Triangle meshes", "[Math][Geometry][TriangleMesh]")
+{
+    RandomGeometry random(Math::u64(71));
+
+    // Note(3011): A bumpy grid of 20 x 20 quads, every inner vertex shared by
+    // six triangles.
+    std::vector<Point<f32>> vertices;
+    for (int y = 0; y <= 20; ++y)
+    {
+        for (int x = 0; x <= 20; ++x)
+        {
+            vertices.emplace_back(f32(x) * f32(0.5) - f32(5), f32(y) * f32(0.5) - f32(5), (random.Unit() - f32(0.5)) * f32(0.4));
+        }
+    }
+    std::vector<u32> indices;
+    for (u32 y = 0; y < 20; ++y)
+    {
+        for (u32 x = 0; x < 20; ++x)
+        {
+            u32 corner = y * u32(21) + x;
+            indices.insert(indices.end(), { corner, corner + u32(1), corner + u32(22) });
+            indices.insert(indices.end(), { corner, corner + u32(22), corner + u32(21) });
+        }
+    }
+    indices.push_back(u32(0));
+
+    std::span<const Point<f32>> vertexSpan(vertices);
+    std::span<const u32> indexSpan(indices);
+    TriangleMesh<f32> mesh(vertexSpan, indexSpan);
+
+    SECTION("Layout")
+    {
+        REQUIRE(mesh.VertexCount() == 441);
+        REQUIRE(mesh.TriangleCount() == 800);
+        REQUIRE(mesh.Indices().size() == 2400);
+
+        Triangle<f32> triangle = mesh.GetTriangle(801 - 2);
+        REQUIRE(triangle.A.x == vertices[19 * 21 + 19].x);
+        REQUIRE(triangle.C.y == vertices[20 * 21 + 19].y);
+        REQUIRE(mesh.Normal(799).z == triangle.SurfaceNormal(triangle.A).z);
+
+        Box<f32> bounds = mesh.Bounds();
+        REQUIRE(bounds.Min.x == f32(-5));
+        REQUIRE(bounds.Max.y == f32(5));
+
+        std::vector<Box<f32>> triangleBounds = mesh.TriangleBounds();
+        REQUIRE(triangleBounds.size() == 800);
+        REQUIRE(triangleBounds[0].Min.x == f32(-5));
+        REQUIRE(triangleBounds[0].Max.x == f32(-4.5));
+
+        REQUIRE(TriangleMesh<f32>().TriangleCount() == 0);
+        REQUIRE_FALSE(TriangleMesh<f32>().NearestIntersection(Ray<f32>(random.Point3(f32(1)), Math::Vector3f(f32(1))), {}));
+    }
+
+    SECTION("Hits match the single triangle tests")
+    {
+        std::vector<Box<f32>> triangleBounds = mesh.TriangleBounds();
+        BVH<f32> tree{ std::span<const Box<f32>>(triangleBounds) };
+        std::vector<u32> some = { 3, 400, 401, 799 };
+
+        int hits = 0;
+        for (int i = 0; i < 1000; ++i)
+        {
+            Point<f32> origin = random.Point3(f32(12));
+            Ray<f32> ray(origin, random.Point3(f32(8)) - origin);
+
+            TriangleMesh<f32>::Hit expected;
+            for (SizeType t = 0; t < mesh.TriangleCount(); ++t)
+            {
+                TriangleIntersection<f32> hit = NearestIntersection(ray, {}, PrecomputedTriangle<f32>(mesh.GetTriangle(t)));
+                REQUIRE(Same(mesh.NearestIntersection(ray, {}, t).Distance, hit.Distance));
+                if (hit && (!expected || hit.Distance < expected.Distance))
+                {
+                    expected.Distance = hit.Distance;
+                    expected.U = hit.U;
+                    expected.V = hit.V;
+                    expected.Index = t;
+                }
+            }
+
+            TriangleMesh<f32>::Hit hit = mesh.NearestIntersection(ray, {});
+            REQUIRE(hit.IsValid() == expected.IsValid());
+            REQUIRE(mesh.HasIntersection(ray, {}) == expected.IsValid());
+            REQUIRE(HasIntersection(ray, {}, tree, mesh) == expected.IsValid());
+            if (expected)
+            {
+                ++hits;
+                REQUIRE(hit.Distance == expected.Distance);
+                REQUIRE(hit.Index == expected.Index);
+                REQUIRE(hit.U == expected.U);
+                REQUIRE(hit.V == expected.V);
+
+                TriangleMesh<f32>::Hit treeHit = NearestIntersection(ray, {}, tree, mesh);
+                REQUIRE(treeHit.Distance == expected.Distance);
+                REQUIRE(treeHit.Index == expected.Index);
+                REQUIRE(treeHit.U == expected.U);
+                REQUIRE(treeHit.V == expected.V);
+            }
+
+            TriangleMesh<f32>::Hit partial = mesh.NearestIntersection(ray, {}, std::span<const u32>(some));
+            REQUIRE(mesh.HasIntersection(ray, {}, std::span<const u32>(some)) == partial.IsValid());
+        }
+        REQUIRE(hits > 300);
+    }
+}
@@ -0,0 +1,106 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Noise.hpp>
+
+#include <vector>
+
+using namespace Math::Types;
+
+TEST_CASE("Baking noise on a grid", "[Math][Noise]")
+{
+    SECTION("Samples are the noise at the grid points")
+    {
+        Math::Noise::Perlin<f32> perlin(3);
+        Math::Vector2f origin(f32(-7.5), f32(3.25));
+        Math::Vector2f extent(f32(30), f32(14));
+        Math::Vector2T<SizeType> resolution(150, 70);
+        std::vector<f32> values(150 * 70);
+        Math::Noise::Bake(perlin, origin, extent, resolution, values, 3);
+
+        Math::Vector2f step(extent.x / f32(150), extent.y / f32(70));
+        for (SizeType y = 0; y < resolution.y; ++y)
+        {
+            for (SizeType x = 0; x < resolution.x; ++x)
+            {
+                Math::Vector2f point(origin.x + step.x * Math::Cast<f32>(x), origin.y + step.y * Math::Cast<f32>(y));
+                REQUIRE(values[Math::ToUnderlying(y * resolution.x + x)] == perlin(point));
+            }
+        }
+    }
+
+    SECTION("Rows wider than a tile are baked whole")
+    {
+        Math::Noise::Worley<f32> worley(8);
+        Math::Vector2f origin(f32(-20), f32(1.5));
+        Math::Vector2f extent(f32(600), f32(2));
+        Math::Vector2T<SizeType> resolution(5000, 5);
+        std::vector<f32> values(5000 * 5);
+        Math::Noise::Bake(worley, origin, extent, resolution, values, 4);
+
+        Math::Vector2f step(extent.x / f32(5000), extent.y / f32(5));
+        for (SizeType y = 0; y < resolution.y; ++y)
+        {
+            for (SizeType x = 0; x < resolution.x; ++x)
+            {
+                Math::Vector2f point(origin.x + step.x * Math::Cast<f32>(x), origin.y + step.y * Math::Cast<f32>(y));
+                REQUIRE(values[Math::ToUnderlying(y * resolution.x + x)] == worley(point));
+            }
+        }
+    }
+
+    SECTION("Noises without batch evaluation are sampled point by point")
+    {
+        auto ramp = [](const Math::Vector3d& point) { return point.x + f64(100) * point.y + f64(10000) * point.z; };
+        Math::Vector3T<SizeType> resolution(70, 9, 13);
+        std::vector<f64> values(70 * 9 * 13);
+        Math::Noise::Bake(ramp, Math::Vector3d(f64(0), f64(0), f64(0)), Math::Vector3d(f64(70), f64(9), f64(13)), resolution, values, 2);
+        for (SizeType z = 0; z < resolution.z; ++z)
+        {
+            for (SizeType y = 0; y < resolution.y; ++y)
+            {
+                for (SizeType x = 0; x < resolution.x; ++x)
+                {
+                    f64 expected = ramp(Math::Vector3d(Math::Cast<f64>(x), Math::Cast<f64>(y), Math::Cast<f64>(z)));
+                    REQUIRE(values[Math::ToUnderlying((z * resolution.y + y) * resolution.x + x)] == expected);
+                }
+            }
+        }
+    }
+
+    SECTION("Output does not depend on the thread count")
+    {
+        Math::Noise::LayerParameters<f32> parameters;
+        parameters.Octaves = 3;
+        Math::Noise::Layer<f32, Math::Noise::Simplex> layer(11, parameters);
+        Math::Noise::Worley<f32> worley(5);
+
+        Math::Vector3f origin(f32(1), f32(-2), f32(0.5));
+        Math::Vector3f extent(f32(8), f32(4), f32(6));
+        Math::Vector3T<SizeType> resolution(100, 33, 21);
+
+        std::vector<f32> reference(100 * 33 * 21);
+        Math::Noise::Bake(layer, origin, extent, resolution, reference, 1);
+        std::vector<f32> worleyReference(100 * 33 * 21);
+        Math::Noise::Bake(worley, origin, extent, resolution, worleyReference, 1);
+
+        for (SizeType threads : {SizeType(0), SizeType(2), SizeType(3), SizeType(8), SizeType(64)})
+        {
+            std::vector<f32> values(reference.size());
+            Math::Noise::Bake(layer, origin, extent, resolution, values, threads);
+            REQUIRE(values == reference);
+
+            Math::Noise::Bake(worley, origin, extent, resolution, values, threads);
+            REQUIRE(values == worleyReference);
+        }
+    }
+
+    SECTION("Too small buffers are left alone")
+    {
+        Math::Noise::Perlin<f32> perlin;
+        std::vector<f32> values(99, f32(-1));
+        Math::Noise::Bake(perlin, Math::Vector2f(f32(0), f32(0)), Math::Vector2f(f32(1), f32(1)), Math::Vector2T<SizeType>(10, 10), values, 2);
+        for (f32 value : values)
+        {
+            REQUIRE(value == f32(-1));
+        }
+    }
+}
@@ -0,0 +1,82 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Noise.hpp>
+
+using namespace Math::Types;
+using Math::Noise::WorleyFeature;
+using Math::Noise::WorleyMetric;
+
+namespace
+{
+    // Note(3011): Compares the analytic gradients with central differences.
+    // Worley noise has creases where the closest feature point changes, so
+    // a few samples may disagree there, and the fraction of matching
+    // samples is checked instead of every single one.
+    template <typename Noise, typename Vector>
+    double MatchingFraction(const Noise& noise, Math::Random64& rng, int samples, f64 tolerance)
+    {
+        constexpr f64 h = 1e-6;
+        constexpr std::size_t dimensions = sizeof(Vector) / sizeof(f64);
+        Math::UniformUnitDistribution<f64> dist;
+
+        int matching = 0;
+        for (int i = 0; i < samples; ++i)
+        {
+            Vector point;
+            for (std::size_t axis = 0; axis < dimensions; ++axis)
+            {
+                point[axis] = dist(rng) * f64(64);
+            }
+
+            auto [value, gradient] = noise.EvaluateWithGradient(point);
+            REQUIRE(value == noise(point));
+
+            bool match = true;
+            for (std::size_t axis = 0; axis < dimensions; ++axis)
+            {
+                Vector forward = point;
+                Vector backward = point;
+                forward[axis] += h;
+                backward[axis] -= h;
+                f64 difference = (noise(forward) - noise(backward)) / (f64(2) * h);
+                match = match && Math::Equal(gradient[axis], difference, tolerance);
+            }
+            matching += match ? 1 : 0;
+        }
+        return double(matching) / double(samples);
+    }
+}
+
+TEST_CASE("Noise gradients", "[Math][Noise]")
+{
+    Math::Random64 rng(31);
+
+    SECTION("Perlin")
+    {
+        Math::Noise::Perlin<f64> noise(5);
+        REQUIRE(MatchingFraction<Math::Noise::Perlin<f64>, Math::Vector2d>(noise, rng, 2000, f64(1e-5)) == 1.0);
+        REQUIRE(MatchingFraction<Math::Noise::Perlin<f64>, Math::Vector3d>(noise, rng, 2000, f64(1e-5)) == 1.0);
+        REQUIRE(MatchingFraction<Math::Noise::Perlin<f64>, Math::Vector4d>(noise, rng, 2000, f64(1e-5)) == 1.0);
+    }
+
+    SECTION("Simplex")
+    {
+        Math::Noise::Simplex<f64> noise(5);
+        REQUIRE(MatchingFraction<Math::Noise::Simplex<f64>, Math::Vector2d>(noise, rng, 2000, f64(1e-5)) == 1.0);
+        REQUIRE(MatchingFraction<Math::Noise::Simplex<f64>, Math::Vector3d>(noise, rng, 2000, f64(1e-5)) == 1.0);
+        REQUIRE(MatchingFraction<Math::Noise::Simplex<f64>, Math::Vector4d>(noise, rng, 2000, f64(1e-5)) == 1.0);
+    }
+
+    SECTION("Worley")
+    {
+        for (WorleyFeature feature : {WorleyFeature::F1, WorleyFeature::F2, WorleyFeature::F2MinusF1})
+        {
+            for (WorleyMetric metric : {WorleyMetric::Euclidean, WorleyMetric::Manhattan, WorleyMetric::Chebyshev})
+            {
+                Math::Noise::Worley<f64> noise(5, feature, metric);
+                REQUIRE(MatchingFraction<Math::Noise::Worley<f64>, Math::Vector2d>(noise, rng, 1000, f64(1e-5)) > 0.99);
+                REQUIRE(MatchingFraction<Math::Noise::Worley<f64>, Math::Vector3d>(noise, rng, 1000, f64(1e-5)) > 0.99);
+                REQUIRE(MatchingFraction<Math::Noise::Worley<f64>, Math::Vector4d>(noise, rng, 1000, f64(1e-5)) > 0.99);
+            }
+        }
+    }
+}
@@ -0,0 +1,136 @@
+#include "NoiseTestsCommon.hpp"
+
+#include <vector>
+
+using namespace Math::Types;
+using Math::Noise::IntegerHash;
+
+template <typename Float>
+using HashedPerlin = Math::Noise::Perlin<Float, IntegerHash>;
+
+TEST_CASE("Perlin noise with the integer hash", "[Math][Noise]")
+{
+    RandomPoints<f32> random(Math::u64(47), f32(1000));
+
+    HashedPerlin<f32> noise(9);
+
+    SECTION("Values are spread like the ones of the permutation table")
+    {
+        // Note(3011): Perlin noise is not normalized to [0, 1], the hashes
+        // should reach about the same values around the same mean.
+        Math::Noise::Perlin<f32> table(9);
+        f64 sums[2] = {};
+        f32 lows[2] = { f32(1), f32(1) };
+        f32 highs[2] = { f32(0), f32(0) };
+        for (int i = 0; i < 20000; ++i)
+        {
+            Math::Vector3f point = random.Point3();
+            f32 values[2] = { noise(point), table(point) };
+            for (int k = 0; k < 2; ++k)
+            {
+                sums[k] += Math::Cast<f64>(values[k]);
+                lows[k] = Math::Min(lows[k], values[k]);
+                highs[k] = Math::Max(highs[k], values[k]);
+            }
+        }
+        REQUIRE(Math::Abs(sums[0] / f64(20000) - f64(0.5)) < f64(0.01));
+        REQUIRE(Math::Abs(sums[1] / f64(20000) - f64(0.5)) < f64(0.01));
+        REQUIRE(Math::Abs(lows[0] - lows[1]) < f32(0.1));
+        REQUIRE(Math::Abs(highs[0] - highs[1]) < f32(0.1));
+    }
+
+    SECTION("Noise does not repeat after 256 cells")
+    {
+        int same = 0;
+        for (int i = 0; i < 200; ++i)
+        {
+            Math::Vector3f point = random.Point3();
+            if (noise(point) == noise(point + Math::Vector3f(f32(256), f32(0), f32(0))))
+            {
+                ++same;
+            }
+        }
+        REQUIRE(same < 10);
+    }
+
+    SECTION("Seeds change the noise")
+    {
+        HashedPerlin<f32> other(10);
+        int same = 0;
+        for (int i = 0; i < 200; ++i)
+        {
+            Math::Vector2f point = random.Point2();
+            if (noise(point) == other(point))
+            {
+                ++same;
+            }
+        }
+        REQUIRE(same < 10);
+    }
+
+    SECTION("Periods beyond 256 cells")
+    {
+        HashedPerlin<f32> periodic(3, 1000);
+        REQUIRE(periodic.Period() == 1000);
+        REQUIRE(HashedPerlin<f32>::MaxPeriod > 256);
+        RandomPoints<f32> lattice(Math::u64(53), f32(64));
+        for (int i = 0; i < 500; ++i)
+        {
+            Math::Vector2f p2 = lattice.LatticePoint2();
+            REQUIRE(periodic(p2) == periodic(p2 + Math::Vector2f(f32(1000), f32(-1000))));
+
+            Math::Vector3f p3 = lattice.LatticePoint3();
+            REQUIRE(periodic(p3) == periodic(p3 + Math::Vector3f(f32(0), f32(1000), f32(0))));
+        }
+    }
+
+    SECTION("Batch, grid and gradient evaluation match")
+    {
+        std::vector<Math::Vector3f> points;
+        for (int i = 0; i < 100; ++i)
+        {
+            points.push_back(random.Point3());
+        }
+        std::vector<f32> values(points.size());
+        noise.Evaluate(std::span<const Math::Vector3f>(points), std::span<f32>(values));
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            REQUIRE(values[i] == noise(points[i]));
+            REQUIRE(noise.EvaluateWithGradient(points[i]).Value == values[i]);
+        }
+
+        Math::Vector2f origin(f32(-3.5), f32(-2.25));
+        Math::Vector2f step(f32(0.125), f32(0.25));
+        Math::Vector2T<SizeType> dims(80, 30);
+        std::vector<f32> grid(80 * 30);
+        noise.FillGrid(origin, step, dims, std::span<f32>(grid));
+        for (SizeType y = 0; y < dims.y; ++y)
+        {
+            for (SizeType x = 0; x < dims.x; ++x)
+            {
+                Math::Vector2f point(origin.x + step.x * Math::Cast<f32>(x), origin.y + step.y * Math::Cast<f32>(y));
+                REQUIRE(grid[Math::ToUnderlying(y * dims.x + x)] == noise(point));
+            }
+        }
+    }
+
+    SECTION("Layers of hashed noise")
+    {
+        Math::Noise::LayerParameters<f32> parameters;
+        parameters.Octaves = 3;
+        Math::Noise::Layer<f32, HashedPerlin> layer(4, parameters);
+        Math::Noise::Layer<f32, HashedPerlin> same(4, parameters);
+        Math::Noise::Layer<f32, Math::Noise::Perlin> table(4, parameters);
+        int differences = 0;
+        for (int i = 0; i < 200; ++i)
+        {
+            Math::Vector3f point = random.Point3();
+            REQUIRE(layer(point) == same(point));
+            if (layer(point) != table(point))
+            {
+                ++differences;
+            }
+        }
+        REQUIRE(differences > 190);
+    }
+}
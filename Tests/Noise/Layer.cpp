@@ -0,0 +1,204 @@
+#include "NoiseTestsCommon.hpp"
+
+#include <span>
+
+using namespace Math::Types;
+using Math::ToUnderlying;
+using Math::Noise::FractalMode;
+using Math::Noise::Layer;
+using Math::Noise::LayerParameters;
+
+TEST_CASE("Fractal noise layers", "[Math][Noise]")
+{
+    RandomPoints<f64> random(Math::u64(13), f64(64));
+
+    SECTION("A single octave is the base noise")
+    {
+        LayerParameters<f64> parameters;
+        parameters.Octaves = 1;
+        Layer<f64, Math::Noise::Perlin> layer(7, parameters);
+        Math::Noise::Perlin<f64> perlin(7);
+        for (int i = 0; i < 1000; ++i)
+        {
+            Math::Vector3d point = random.Point3();
+            REQUIRE(Math::Equal(layer(point), perlin(point), f64(1e-12)));
+        }
+    }
+
+    SECTION("Octaves keep the settings of the prototype")
+    {
+        LayerParameters<f64> parameters;
+        parameters.Octaves = 1;
+        Math::Noise::Worley<f64> prototype(0, Math::Noise::WorleyFeature::F2, Math::Noise::WorleyMetric::Manhattan);
+        Layer<f64, Math::Noise::Worley> worley(prototype, 7, parameters);
+        Math::Noise::Worley<f64> reference(7, Math::Noise::WorleyFeature::F2, Math::Noise::WorleyMetric::Manhattan);
+        for (int i = 0; i < 1000; ++i)
+        {
+            Math::Vector2d point = random.Point2();
+            REQUIRE(Math::Equal(worley(point), reference(point), f64(1e-12)));
+        }
+
+        parameters.Octaves = 4;
+        Layer<f64, Math::Noise::Perlin> periodic(Math::Noise::Perlin<f64>(0, 16), 7, parameters);
+        for (int i = 0; i < 1000; ++i)
+        {
+            Math::Vector3d point = random.Point3();
+            REQUIRE(Math::Equal(periodic(point), periodic(point + Math::Vector3d(f64(16), f64(-32), f64(16))), f64(1e-9)));
+        }
+    }
+
+    SECTION("Octave count is clamped")
+    {
+        LayerParameters<f64> parameters;
+        parameters.Octaves = 0;
+        REQUIRE(Layer<f64, Math::Noise::Perlin>(1, parameters).Octaves() == 1);
+        parameters.Octaves = 100;
+        REQUIRE(Layer<f64, Math::Noise::Perlin>(1, parameters).Octaves() == Layer<f64, Math::Noise::Perlin>::MaxOctaves);
+    }
+
+    SECTION("Octaves use their own seeds")
+    {
+        // Note(3011): With a lacunarity of 1 and the same seed for every
+        // octave, the octaves would all be the same and the sum would be
+        // the base noise again.
+        LayerParameters<f64> parameters;
+        parameters.Lacunarity = f64(1);
+        Layer<f64, Math::Noise::Simplex> layer(7, parameters);
+        Math::Noise::Simplex<f64> simplex(7);
+        int differences = 0;
+        for (int i = 0; i < 100; ++i)
+        {
+            Math::Vector2d point = random.Point2();
+            differences += Math::Equal(layer(point), simplex(point), f64(1e-6)) ? 0 : 1;
+        }
+        REQUIRE(differences > 90);
+    }
+
+    SECTION("Values are in [0, 1] for every mode")
+    {
+        for (FractalMode mode : {FractalMode::FBm, FractalMode::Billow, FractalMode::Ridged})
+        {
+            LayerParameters<f64> parameters;
+            parameters.Octaves = 5;
+            parameters.Mode = mode;
+            Layer<f64, Math::Noise::Simplex> layer(3, parameters);
+            for (int i = 0; i < 2000; ++i)
+            {
+                f64 value = layer(random.Point4());
+                REQUIRE(value >= f64(0));
+                REQUIRE(value <= f64(1));
+            }
+        }
+    }
+}
+
+TEST_CASE("Batched fractal noise matches the scalar version", "[Math][Noise]")
+{
+    Math::Random64 rng(29);
+    Math::UniformUnitDistribution<f32> dist;
+
+    SECTION("Point batches")
+    {
+        constexpr std::size_t count = 150;
+        Math::Vector2f points2[count];
+        Math::Vector3f points3[count];
+        Math::Vector4f points4[count];
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            f32 x = dist(rng) * 64.0f - 32.0f;
+            f32 y = dist(rng) * 64.0f - 32.0f;
+            f32 z = dist(rng) * 64.0f - 32.0f;
+            f32 w = dist(rng) * 64.0f - 32.0f;
+            points2[i] = Math::Vector2f(x, y);
+            points3[i] = Math::Vector3f(x, y, z);
+            points4[i] = Math::Vector4f(x, y, z, w);
+        }
+
+        for (FractalMode mode : {FractalMode::FBm, FractalMode::Billow, FractalMode::Ridged})
+        {
+            LayerParameters<f32> parameters;
+            parameters.Octaves = 5;
+            parameters.Lacunarity = f32(2.3f);
+            parameters.Gain = f32(0.45f);
+            parameters.Mode = mode;
+            Layer<f32, Math::Noise::Perlin> perlin(2, parameters);
+            Layer<f32, Math::Noise::Worley> worley(2, parameters);
+
+            f32 values[count];
+            perlin.Evaluate(std::span<const Math::Vector2f>(points2), values);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                REQUIRE(values[i] == perlin(points2[i]));
+            }
+
+            worley.Evaluate(std::span<const Math::Vector3f>(points3), values);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                REQUIRE(values[i] == worley(points3[i]));
+            }
+
+            // Note(3011): Perlin has no 4D batch version, the layer falls
+            // back to evaluating point by point.
+            perlin.Evaluate(std::span<const Math::Vector4f>(points4), values);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                REQUIRE(values[i] == perlin(points4[i]));
+            }
+        }
+    }
+
+    SECTION("2D grid")
+    {
+        Layer<f32, Math::Noise::Simplex> layer(4);
+        Math::Vector2f origin(-3.3f, 1.25f);
+        Math::Vector2f step(0.1f, 0.35f);
+        Math::Vector2sz dims(67, 9);
+        f32 values[67 * 9];
+        layer.FillGrid(origin, step, dims, values);
+
+        for (SizeType y = 0; y < dims.y; ++y)
+        {
+            for (SizeType x = 0; x < dims.x; ++x)
+            {
+                Math::Vector2f point(origin.x + step.x * Math::Cast<f32>(x), origin.y + step.y * Math::Cast<f32>(y));
+                REQUIRE(values[ToUnderlying(y * dims.x + x)] == layer(point));
+            }
+        }
+    }
+
+    SECTION("3D grid")
+    {
+        Layer<f32, Math::Noise::Perlin> layer(4);
+        Math::Vector3f origin(0.5f, -2.0f, 7.75f);
+        Math::Vector3f step(0.2f, 0.3f, 0.45f);
+        Math::Vector3T<SizeType> dims(19, 5, 4);
+        f32 values[19 * 5 * 4];
+        layer.FillGrid(origin, step, dims, values);
+
+        for (SizeType z = 0; z < dims.z; ++z)
+        {
+            for (SizeType y = 0; y < dims.y; ++y)
+            {
+                for (SizeType x = 0; x < dims.x; ++x)
+                {
+                    Math::Vector3f point(origin.x + step.x * Math::Cast<f32>(x),
+                                         origin.y + step.y * Math::Cast<f32>(y),
+                                         origin.z + step.z * Math::Cast<f32>(z));
+                    REQUIRE(values[ToUnderlying((z * dims.y + y) * dims.x + x)] == layer(point));
+                }
+            }
+        }
+    }
+
+    SECTION("Grids larger than the span are not written")
+    {
+        Layer<f32, Math::Noise::Worley> layer(4);
+        f32 values[4] = { -1.0f, -1.0f, -1.0f, -1.0f };
+        layer.FillGrid(Math::Vector2f(0.5f, 0.5f), Math::Vector2f(0.25f, 0.25f), Math::Vector2sz(8, 8), values);
+        layer.FillGrid(Math::Vector3f(0.5f, 0.5f, 0.5f), Math::Vector3f(0.25f, 0.25f, 0.25f), Math::Vector3T<SizeType>(2, 2, 2), values);
+        for (f32 value : values)
+        {
+            REQUIRE(value == -1.0f);
+        }
+    }
+}
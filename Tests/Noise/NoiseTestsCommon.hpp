@@ -0,0 +1,84 @@
+#ifndef MATHLIB_TESTS_NOISE_TESTS_COMMON_HPP
+#define MATHLIB_TESTS_NOISE_TESTS_COMMON_HPP
+
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Noise.hpp>
+#include <Math/Random.hpp>
+
+// Note(3011): Random sample points for the noise tests, every coordinate in
+// [-extent, extent). The coordinates are drawn in the order x, y, z, w.
+template <Math::Concept::StrongFloatType Float>
+class RandomPoints final
+{
+public:
+    RandomPoints(Math::u64 seed, Float extent)
+        : mRng(seed), mExtent(extent)
+    {}
+
+    Float Coordinate()
+    {
+        return mDistribution(mRng) * (mExtent + mExtent) - mExtent;
+    }
+
+    Math::Vector2T<Float> Point2()
+    {
+        Float x = Coordinate();
+        Float y = Coordinate();
+        return Math::Vector2T<Float>(x, y);
+    }
+
+    Math::Vector3T<Float> Point3()
+    {
+        Float x = Coordinate();
+        Float y = Coordinate();
+        Float z = Coordinate();
+        return Math::Vector3T<Float>(x, y, z);
+    }
+
+    Math::Vector4T<Float> Point4()
+    {
+        Float x = Coordinate();
+        Float y = Coordinate();
+        Float z = Coordinate();
+        Float w = Coordinate();
+        return Math::Vector4T<Float>(x, y, z, w);
+    }
+
+    // Note(3011): On multiples of 1/64, so shifting these by a whole period
+    // does not change their fractional part.
+    Float LatticeCoordinate()
+    {
+        Float steps = mDistribution(mRng) * (mExtent + mExtent) * Float(64);
+        return Math::Cast<Float>(Math::Floor<Math::i64>(steps)) / Float(64) - mExtent;
+    }
+
+    Math::Vector2T<Float> LatticePoint2()
+    {
+        Float x = LatticeCoordinate();
+        Float y = LatticeCoordinate();
+        return Math::Vector2T<Float>(x, y);
+    }
+
+    Math::Vector3T<Float> LatticePoint3()
+    {
+        Float x = LatticeCoordinate();
+        Float y = LatticeCoordinate();
+        Float z = LatticeCoordinate();
+        return Math::Vector3T<Float>(x, y, z);
+    }
+
+    Math::Vector4T<Float> LatticePoint4()
+    {
+        Float x = LatticeCoordinate();
+        Float y = LatticeCoordinate();
+        Float z = LatticeCoordinate();
+        Float w = LatticeCoordinate();
+        return Math::Vector4T<Float>(x, y, z, w);
+    }
+private:
+    Math::Random64 mRng;
+    Math::UniformUnitDistribution<Float> mDistribution;
+    Float mExtent;
+};
+
+#endif //MATHLIB_TESTS_NOISE_TESTS_COMMON_HPP
@@ -0,0 +1,94 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Noise.hpp>
+
+#include <span>
+
+using namespace Math::Types;
+using Math::ToUnderlying;
+
+TEST_CASE("Batched Perlin noise matches the scalar version", "[Math][Noise]")
+{
+    Math::Noise::Perlin<f32> noise(3);
+    Math::Random64 rng(21);
+    Math::UniformUnitDistribution<f32> dist;
+
+    SECTION("Point batches")
+    {
+        constexpr std::size_t count = 37;
+        Math::Vector2f points2[count];
+        Math::Vector3f points3[count];
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            f32 x = dist(rng) * 64.0f - 32.0f;
+            f32 y = dist(rng) * 64.0f - 32.0f;
+            f32 z = dist(rng) * 64.0f - 32.0f;
+            points2[i] = Math::Vector2f(x, y);
+            points3[i] = Math::Vector3f(x, y, z);
+        }
+
+        f32 values[count];
+        noise.Evaluate(std::span<const Math::Vector2f>(points2), values);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            REQUIRE(values[i] == noise(points2[i]));
+        }
+
+        noise.Evaluate(std::span<const Math::Vector3f>(points3), values);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            REQUIRE(values[i] == noise(points3[i]));
+        }
+    }
+
+    SECTION("2D grid")
+    {
+        Math::Vector2f origin(-3.3f, 1.25f);
+        Math::Vector2f step(0.1f, 0.35f);
+        Math::Vector2sz dims(67, 9);
+        f32 values[67 * 9];
+        noise.FillGrid(origin, step, dims, values);
+
+        for (SizeType y = 0; y < dims.y; ++y)
+        {
+            for (SizeType x = 0; x < dims.x; ++x)
+            {
+                Math::Vector2f point(origin.x + step.x * Math::Cast<f32>(x), origin.y + step.y * Math::Cast<f32>(y));
+                REQUIRE(values[ToUnderlying(y * dims.x + x)] == noise(point));
+            }
+        }
+    }
+
+    SECTION("3D grid")
+    {
+        Math::Vector3f origin(0.5f, -2.0f, 7.75f);
+        Math::Vector3f step(0.2f, 0.3f, 0.45f);
+        Math::Vector3T<SizeType> dims(19, 5, 4);
+        f32 values[19 * 5 * 4];
+        noise.FillGrid(origin, step, dims, values);
+
+        for (SizeType z = 0; z < dims.z; ++z)
+        {
+            for (SizeType y = 0; y < dims.y; ++y)
+            {
+                for (SizeType x = 0; x < dims.x; ++x)
+                {
+                    Math::Vector3f point(origin.x + step.x * Math::Cast<f32>(x),
+                                         origin.y + step.y * Math::Cast<f32>(y),
+                                         origin.z + step.z * Math::Cast<f32>(z));
+                    REQUIRE(values[ToUnderlying((z * dims.y + y) * dims.x + x)] == noise(point));
+                }
+            }
+        }
+    }
+
+    SECTION("Grids larger than the span are not written")
+    {
+        f32 values[4] = { -1.0f, -1.0f, -1.0f, -1.0f };
+        noise.FillGrid(Math::Vector2f(0.5f, 0.5f), Math::Vector2f(0.25f, 0.25f), Math::Vector2sz(8, 8), values);
+        noise.FillGrid(Math::Vector3f(0.5f, 0.5f, 0.5f), Math::Vector3f(0.25f, 0.25f, 0.25f), Math::Vector3T<SizeType>(2, 2, 2), values);
+        for (f32 value : values)
+        {
+            REQUIRE(value == -1.0f);
+        }
+    }
+}
@@ -0,0 +1,145 @@
+#include "NoiseTestsCommon.hpp"
+
+#include <vector>
+
+using namespace Math::Types;
+using Math::Noise::BakedNoise;
+using Math::Noise::Perlin;
+
+TEST_CASE("Periodic Perlin noise", "[Math][Noise]")
+{
+    RandomPoints<f32> random(Math::u64(41), f32(32));
+
+    SECTION("Period is clamped")
+    {
+        REQUIRE(Perlin<f32>(1).Period() == 0);
+        REQUIRE(Perlin<f32>(1, 12).Period() == 12);
+        REQUIRE(Perlin<f32>(1, 1000).Period() == Perlin<f32>::MaxPeriod);
+    }
+
+    SECTION("Noise repeats every period")
+    {
+        for (SizeType period : {SizeType(5), SizeType(8), SizeType(256)})
+        {
+            Perlin<f32> noise(7, period);
+            f32 shift = Math::Cast<f32>(period);
+            for (int i = 0; i < 500; ++i)
+            {
+                Math::Vector2f p2 = random.LatticePoint2();
+                REQUIRE(noise(p2) == noise(p2 + Math::Vector2f(shift, f32(0))));
+                REQUIRE(noise(p2) == noise(p2 - Math::Vector2f(f32(0), shift)));
+
+                Math::Vector3f p3 = random.LatticePoint3();
+                REQUIRE(noise(p3) == noise(p3 + Math::Vector3f(shift, f32(0), f32(0))));
+                REQUIRE(noise(p3) == noise(p3 + Math::Vector3f(f32(0), shift, -shift)));
+
+                Math::Vector4f p4 = random.LatticePoint4();
+                REQUIRE(noise(p4) == noise(p4 + Math::Vector4f(f32(0), f32(0), f32(0), shift)));
+                REQUIRE(noise.EvaluateWithGradient(p3).Value == noise(p3));
+            }
+        }
+    }
+
+    SECTION("Batch and grid evaluation match")
+    {
+        Perlin<f32> noise(3, 6);
+        std::vector<Math::Vector3f> points;
+        for (int i = 0; i < 100; ++i)
+        {
+            points.push_back(random.LatticePoint3());
+        }
+        std::vector<f32> values(points.size());
+        noise.Evaluate(std::span<const Math::Vector3f>(points), std::span<f32>(values));
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            REQUIRE(values[i] == noise(points[i]));
+        }
+
+        Math::Vector2f origin(f32(-3.5), f32(-2.25));
+        Math::Vector2f step(f32(0.125), f32(0.25));
+        Math::Vector2T<SizeType> dims(96, 40);
+        std::vector<f32> grid(96 * 40);
+        noise.FillGrid(origin, step, dims, std::span<f32>(grid));
+        for (SizeType y = 0; y < dims.y; ++y)
+        {
+            for (SizeType x = 0; x < dims.x; ++x)
+            {
+                Math::Vector2f point(origin.x + step.x * Math::Cast<f32>(x), origin.y + step.y * Math::Cast<f32>(y));
+                REQUIRE(grid[Math::ToUnderlying(y * dims.x + x)] == noise(point));
+            }
+        }
+    }
+}
+
+TEST_CASE("Baked noise", "[Math][Noise]")
+{
+    Math::Random64 rng(43);
+    Math::UniformUnitDistribution<f32> dist;
+
+    Perlin<f32> noise(5, 4);
+    BakedNoise<f32, 2> baked2(noise, Math::Vector2f(f32(0), f32(0)), Math::Vector2f(f32(4), f32(4)), Math::Vector2T<SizeType>(64, 64));
+    BakedNoise<f32, 3> baked3(noise, Math::Vector3f(f32(0), f32(0), f32(0)), Math::Vector3f(f32(4), f32(4), f32(4)), Math::Vector3T<SizeType>(32, 32, 32));
+
+    SECTION("Lookups at the samples return them")
+    {
+        REQUIRE(baked2.Values().size() == 64 * 64);
+        REQUIRE(baked2.Resolution().x == 64);
+        for (SizeType y = 0; y < 64; ++y)
+        {
+            for (SizeType x = 0; x < 64; ++x)
+            {
+                Math::Vector2f point(Math::Cast<f32>(x) / f32(16), Math::Cast<f32>(y) / f32(16));
+                f32 value = baked2.Values()[Math::ToUnderlying(y * 64 + x)];
+                REQUIRE(baked2(point) == value);
+                REQUIRE(value == noise(point));
+            }
+        }
+        for (int i = 0; i < 200; ++i)
+        {
+            SizeType x = Math::Cast<SizeType>(rng() % u64(32));
+            SizeType y = Math::Cast<SizeType>(rng() % u64(32));
+            SizeType z = Math::Cast<SizeType>(rng() % u64(32));
+            Math::Vector3f point(Math::Cast<f32>(x) / f32(8), Math::Cast<f32>(y) / f32(8), Math::Cast<f32>(z) / f32(8));
+            REQUIRE(baked3(point) == baked3.Values()[Math::ToUnderlying((z * 32 + y) * 32 + x)]);
+        }
+    }
+
+    SECTION("Lookups are close to the noise and tile without seams")
+    {
+        for (int i = 0; i < 2000; ++i)
+        {
+            Math::Vector2f p2(dist(rng) * f32(4), dist(rng) * f32(4));
+            REQUIRE(Math::Abs(baked2(p2) - noise(p2)) < f32(0.02));
+            REQUIRE(Math::Equal(baked2(p2), baked2(p2 + Math::Vector2f(f32(-4), f32(8))), f32(1e-4)));
+
+            Math::Vector3f p3(dist(rng) * f32(4), dist(rng) * f32(4), dist(rng) * f32(4));
+            REQUIRE(Math::Abs(baked3(p3) - noise(p3)) < f32(0.05));
+            REQUIRE(Math::Equal(baked3(p3), baked3(p3 + Math::Vector3f(f32(4), f32(-4), f32(12))), f32(1e-4)));
+        }
+
+        // Note(3011): Across the edge of the tile, between the last sample
+        // and the first one of the next tile.
+        for (int i = 0; i < 100; ++i)
+        {
+            Math::Vector2f edge(f32(4) - dist(rng) / f32(16), dist(rng) * f32(4));
+            REQUIRE(Math::Abs(baked2(edge) - noise(edge)) < f32(0.02));
+        }
+    }
+
+    SECTION("Noises without a grid evaluation are sampled point by point")
+    {
+        auto ramp = [](const Math::Vector2f& point) { return point.x / f32(8) + point.y / f32(16); };
+        BakedNoise<f32, 2> bakedRamp(ramp, Math::Vector2f(f32(0), f32(0)), Math::Vector2f(f32(4), f32(4)), Math::Vector2T<SizeType>(8, 8));
+        for (int i = 0; i < 100; ++i)
+        {
+            Math::Vector2f point(dist(rng) * f32(3.5), dist(rng) * f32(3.5));
+            REQUIRE(Math::Equal(bakedRamp(point), ramp(point), f32(1e-5)));
+        }
+
+        std::vector<Math::Vector2f> points = { Math::Vector2f(f32(0.5), f32(1)), Math::Vector2f(f32(1.75), f32(2.5)) };
+        std::vector<f32> values(2);
+        bakedRamp.Evaluate(std::span<const Math::Vector2f>(points), std::span<f32>(values));
+        REQUIRE(values[0] == bakedRamp(points[0]));
+        REQUIRE(values[1] == bakedRamp(points[1]));
+    }
+}
@@ -0,0 +1,223 @@
+#include "NoiseTestsCommon.hpp"
+
+#include <span>
+
+using namespace Math::Types;
+using Math::ToUnderlying;
+using Math::Noise::Worley;
+using Math::Noise::WorleyFeature;
+using Math::Noise::WorleyMetric;
+
+TEST_CASE("Worley noise", "[Math][Noise]")
+{
+    RandomPoints<f64> random(Math::u64(9), f64(256));
+
+    SECTION("Features are ordered and in [0, 1]")
+    {
+        for (WorleyMetric metric : {WorleyMetric::Euclidean, WorleyMetric::Manhattan, WorleyMetric::Chebyshev})
+        {
+            Worley<f64> f1(4, WorleyFeature::F1, metric);
+            Worley<f64> f2(4, WorleyFeature::F2, metric);
+            Worley<f64> difference(4, WorleyFeature::F2MinusF1, metric);
+            for (int i = 0; i < 2000; ++i)
+            {
+                Math::Vector3d point = random.Point3();
+                REQUIRE(f1(point) >= f64(0));
+                REQUIRE(f1(point) <= f2(point));
+                REQUIRE(f2(point) <= f64(1));
+                if (f2(point) < f64(1))
+                {
+                    REQUIRE(Math::Equal(difference(point), f2(point) - f1(point), f64(1e-12)));
+                }
+            }
+        }
+    }
+
+    SECTION("Metrics are ordered")
+    {
+        // Note(3011): Chebyshev <= Euclidean, and the Manhattan distance
+        // divided by sqrt(D) is at most the Euclidean one as well.
+        Worley<f64> euclidean(4, WorleyFeature::F1, WorleyMetric::Euclidean);
+        Worley<f64> manhattan(4, WorleyFeature::F1, WorleyMetric::Manhattan);
+        Worley<f64> chebyshev(4, WorleyFeature::F1, WorleyMetric::Chebyshev);
+        for (int i = 0; i < 2000; ++i)
+        {
+            Math::Vector2d point2 = random.Point2();
+            Math::Vector4d point4 = random.Point4();
+            REQUIRE(chebyshev(point2) <= euclidean(point2) + f64(1e-12));
+            REQUIRE(manhattan(point2) <= euclidean(point2) + f64(1e-12));
+            REQUIRE(chebyshev(point4) <= euclidean(point4) + f64(1e-12));
+            REQUIRE(manhattan(point4) <= euclidean(point4) + f64(1e-12));
+        }
+    }
+
+    SECTION("F1 is continuous")
+    {
+        // Note(3011): The distance to the closest feature point can not
+        // change faster than the sample moves.
+        Worley<f64> noise(4);
+        constexpr f64 delta = 1e-6;
+        for (int i = 0; i < 5000; ++i)
+        {
+            f64 x = random.Coordinate();
+            f64 y = random.Coordinate();
+            f64 z = random.Coordinate();
+            f64 w = random.Coordinate();
+            REQUIRE(Math::Abs(noise(Math::Vector2d(x, y)) - noise(Math::Vector2d(x + delta, y))) <= f64(1.001e-6));
+            REQUIRE(Math::Abs(noise(Math::Vector3d(x, y, z)) - noise(Math::Vector3d(x, y + delta, z))) <= f64(1.001e-6));
+            REQUIRE(Math::Abs(noise(Math::Vector4d(x, y, z, w)) - noise(Math::Vector4d(x, y, z, w + delta))) <= f64(1.001e-6));
+        }
+    }
+
+    SECTION("Seeds are deterministic")
+    {
+        Worley<f64> noise(4);
+        Worley<f64> same(4);
+        Worley<f64> other(5);
+        int differences = 0;
+        for (int i = 0; i < 100; ++i)
+        {
+            Math::Vector2d point = random.Point2();
+            REQUIRE(noise(point) == same(point));
+            differences += (noise(point) != other(point)) ? 1 : 0;
+        }
+        REQUIRE(differences > 90);
+    }
+
+    // Note(3011): The Euclidean F1 gradient points away from the closest
+    // feature point, which recovers it from a sample. Whenever two feature
+    // points share their x jitter, their y jitter has to differ sometimes.
+    SECTION("Feature point coordinates are hashed independently")
+    {
+        Worley<f64> noise(3);
+        i32 jitterY[256];
+        for (i32& y : jitterY)
+        {
+            y = -1;
+        }
+
+        int sharedX = 0;
+        int differentY = 0;
+        for (int cell = 0; cell < 4096; ++cell)
+        {
+            Math::Vector2d point(f64(cell % 64) + f64(0.5), f64(cell / 64) + f64(0.5));
+            auto [value, gradient] = noise.EvaluateWithGradient(point);
+            if (!(value > f64(0.01) && value < f64(0.99)))
+            {
+                continue;
+            }
+
+            f64 featureX = point.x - value * gradient.x;
+            f64 featureY = point.y - value * gradient.y;
+            i32 binX = Math::Cast<i32>(Math::Floor<i64>((featureX - Math::Floor(featureX)) * f64(256)));
+            i32 binY = Math::Cast<i32>(Math::Floor<i64>((featureY - Math::Floor(featureY)) * f64(256)));
+            if (jitterY[ToUnderlying(binX)] >= 0)
+            {
+                ++sharedX;
+                differentY += (jitterY[ToUnderlying(binX)] != binY) ? 1 : 0;
+            }
+            jitterY[ToUnderlying(binX)] = binY;
+        }
+
+        REQUIRE(sharedX > 1000);
+        REQUIRE(differentY > sharedX / 2);
+    }
+}
+
+TEST_CASE("Batched Worley noise matches the scalar version", "[Math][Noise]")
+{
+    Worley<f32> noise(6, WorleyFeature::F2MinusF1, WorleyMetric::Euclidean);
+    Math::Random64 rng(23);
+    Math::UniformUnitDistribution<f32> dist;
+
+    SECTION("Point batches")
+    {
+        // Note(3011): Half of the points walk along x, so the cached
+        // neighborhood gets reused and shifted as well as reloaded.
+        constexpr std::size_t count = 64;
+        Math::Vector2f points2[count];
+        Math::Vector3f points3[count];
+        Math::Vector4f points4[count];
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            f32 x = (i % 2 == 0) ? f32(-4.0f + 0.3f * i) : dist(rng) * 64.0f - 32.0f;
+            f32 y = (i % 2 == 0) ? f32(1.5f) : dist(rng) * 64.0f - 32.0f;
+            f32 z = dist(rng) * 64.0f - 32.0f;
+            f32 w = dist(rng) * 64.0f - 32.0f;
+            points2[i] = Math::Vector2f(x, y);
+            points3[i] = Math::Vector3f(x, y, z);
+            points4[i] = Math::Vector4f(x, y, z, w);
+        }
+
+        f32 values[count];
+        noise.Evaluate(std::span<const Math::Vector2f>(points2), values);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            REQUIRE(values[i] == noise(points2[i]));
+        }
+
+        noise.Evaluate(std::span<const Math::Vector3f>(points3), values);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            REQUIRE(values[i] == noise(points3[i]));
+        }
+
+        noise.Evaluate(std::span<const Math::Vector4f>(points4), values);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            REQUIRE(values[i] == noise(points4[i]));
+        }
+    }
+
+    SECTION("2D grid")
+    {
+        Math::Vector2f origin(-3.3f, 1.25f);
+        Math::Vector2f step(0.1f, 0.35f);
+        Math::Vector2sz dims(67, 9);
+        f32 values[67 * 9];
+        noise.FillGrid(origin, step, dims, values);
+
+        for (SizeType y = 0; y < dims.y; ++y)
+        {
+            for (SizeType x = 0; x < dims.x; ++x)
+            {
+                Math::Vector2f point(origin.x + step.x * Math::Cast<f32>(x), origin.y + step.y * Math::Cast<f32>(y));
+                REQUIRE(values[ToUnderlying(y * dims.x + x)] == noise(point));
+            }
+        }
+    }
+
+    SECTION("3D grid")
+    {
+        Math::Vector3f origin(0.5f, -2.0f, 7.75f);
+        Math::Vector3f step(0.2f, 0.3f, 0.45f);
+        Math::Vector3T<SizeType> dims(19, 5, 4);
+        f32 values[19 * 5 * 4];
+        noise.FillGrid(origin, step, dims, values);
+
+        for (SizeType z = 0; z < dims.z; ++z)
+        {
+            for (SizeType y = 0; y < dims.y; ++y)
+            {
+                for (SizeType x = 0; x < dims.x; ++x)
+                {
+                    Math::Vector3f point(origin.x + step.x * Math::Cast<f32>(x),
+                                         origin.y + step.y * Math::Cast<f32>(y),
+                                         origin.z + step.z * Math::Cast<f32>(z));
+                    REQUIRE(values[ToUnderlying((z * dims.y + y) * dims.x + x)] == noise(point));
+                }
+            }
+        }
+    }
+
+    SECTION("Grids larger than the span are not written")
+    {
+        f32 values[4] = { -1.0f, -1.0f, -1.0f, -1.0f };
+        noise.FillGrid(Math::Vector2f(0.5f, 0.5f), Math::Vector2f(0.25f, 0.25f), Math::Vector2sz(8, 8), values);
+        noise.FillGrid(Math::Vector3f(0.5f, 0.5f, 0.5f), Math::Vector3f(0.25f, 0.25f, 0.25f), Math::Vector3T<SizeType>(2, 2, 2), values);
+        for (f32 value : values)
+        {
+            REQUIRE(value == -1.0f);
+        }
+    }
+}
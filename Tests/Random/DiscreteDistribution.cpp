@@ -0,0 +1,124 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Functions.hpp>
+#include <Math/Random.hpp>
+
+#include <span>
+
+using namespace Math::Types;
+using Math::ToUnderlying;
+
+namespace
+{
+    template <typename RNG>
+    void CountSamples(const Math::DiscreteDistribution<f64>& dist, RNG& rng, u32* counts, std::size_t sampleCount)
+    {
+        SizeType samples[1000];
+        for (std::size_t done = 0; done < sampleCount; done += 1000)
+        {
+            dist.Fill(std::span<SizeType>(samples), rng);
+            for (SizeType sample : samples)
+            {
+                REQUIRE(sample < dist.Size());
+                ++counts[ToUnderlying(sample)];
+            }
+        }
+    }
+}
+
+TEST_CASE("DiscreteDistribution", "[Math][Random]")
+{
+    constexpr std::size_t sampleCount = 200000;
+
+    SECTION("Frequencies follow the weights")
+    {
+        Math::Random64 rng(7);
+        f64 weights[] = { 1.0, 0.0, 3.0, 0.5, 5.5 };
+        Math::DiscreteDistribution<f64> dist(weights);
+
+        REQUIRE(dist.Size() == 5u);
+        REQUIRE(Math::Equal(dist.TotalWeight(), 10.0));
+        REQUIRE(Math::Equal(dist.Probability(2), 0.3));
+
+        u32 counts[5] = {};
+        CountSamples(dist, rng, counts, sampleCount);
+
+        REQUIRE(counts[1] == 0u);
+        for (std::size_t i = 0; i < 5; ++i)
+        {
+            f64 expected = dist.Probability(i) * f64(sampleCount);
+            REQUIRE(Math::Abs(Math::Cast<f64>(counts[i]) - expected) < f64(5) * Math::Sqrt(expected) + f64(1));
+        }
+    }
+
+    SECTION("All zero weights are sampled uniformly")
+    {
+        Math::Random32 rng(3);
+        f64 weights[] = { 0.0, 0.0, 0.0, 0.0 };
+        Math::DiscreteDistribution<f64> dist(weights);
+
+        REQUIRE(Math::Equal(dist.Probability(3), 0.25));
+
+        u32 counts[4] = {};
+        CountSamples(dist, rng, counts, sampleCount);
+        for (u32 count : counts)
+        {
+            REQUIRE(Math::Abs(Math::Cast<f64>(count) - f64(50000)) < f64(1200));
+        }
+    }
+
+    SECTION("Single weight always returns zero")
+    {
+        Math::Random64 rng(1);
+        f32 weights[] = { 2.0f };
+        Math::DiscreteDistribution<f32> dist(weights);
+        for (int i = 0; i < 100; ++i)
+        {
+            REQUIRE(dist(rng) == 0u);
+        }
+    }
+
+    SECTION("Empty distribution returns its size")
+    {
+        Math::Random64 rng(5);
+        Math::Random64 untouched(5);
+
+        Math::DiscreteDistribution<f32> defaulted;
+        REQUIRE(defaulted.Empty());
+        REQUIRE(defaulted(rng) == 0u);
+
+        Math::DiscreteDistribution<f32> built(std::span<const f32>{});
+        REQUIRE(built.Empty());
+
+        SizeType samples[4] = { 7, 7, 7, 7 };
+        built.Fill(std::span<SizeType>(samples), rng);
+        for (SizeType sample : samples)
+        {
+            REQUIRE(sample == 0u);
+        }
+
+        REQUIRE(rng() == untouched());
+    }
+
+    SECTION("Incremental updates rebuild the table")
+    {
+        Math::Random64 rng(11);
+        f64 weights[] = { 1.0, 1.0, 1.0, 1.0 };
+        Math::DiscreteDistribution<f64> dist(weights);
+
+        dist.SetWeight(0, 0.0);
+        dist.SetWeight(3, 2.0);
+        REQUIRE(Math::Equal(dist.TotalWeight(), 4.0));
+        REQUIRE(Math::Equal(dist.Probability(3), 0.5));
+        dist.Rebuild();
+
+        REQUIRE(Math::Equal(dist.Weight(3), 2.0));
+        REQUIRE(Math::Equal(dist.Probability(3), 0.5));
+
+        u32 counts[4] = {};
+        CountSamples(dist, rng, counts, sampleCount);
+
+        REQUIRE(counts[0] == 0u);
+        REQUIRE(Math::Abs(Math::Cast<f64>(counts[3]) - f64(100000)) < f64(1500));
+        REQUIRE(Math::Abs(Math::Cast<f64>(counts[1]) - f64(50000)) < f64(1200));
+    }
+}
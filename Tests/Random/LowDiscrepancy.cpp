@@ -0,0 +1,158 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Functions.hpp>
+#include <Math/Random.hpp>
+
+#include <span>
+
+using namespace Math::Types;
+using Math::ToUnderlying;
+
+namespace
+{
+    // Note(3011): Checks that every one of the `strata` equally sized
+    // intervals of [0, 1) contains exactly one of the values.
+    template <typename T>
+    bool IsStratified(std::span<const T> values, u32 strata)
+    {
+        bool seen[1024] = {};
+        for (T value : values)
+        {
+            if (value < T(0) || value >= T(1))
+            {
+                return false;
+            }
+            u32 stratum = Math::Cast<u32>(Math::Trunc<i64>(value * Math::Cast<T>(strata)));
+            if (seen[ToUnderlying(stratum)])
+            {
+                return false;
+            }
+            seen[ToUnderlying(stratum)] = true;
+        }
+        return true;
+    }
+}
+
+TEST_CASE("Bit utilities", "[Math][Random]")
+{
+    STATIC_REQUIRE(Math::ReverseBits(u32(1)) == u32(0x80000000u));
+    STATIC_REQUIRE(Math::ReverseBits(u32(0x0000f00du)) == u32(0xb00f0000u));
+    STATIC_REQUIRE(Math::ReverseBits(u64(6)) == u64(0x6000000000000000ull));
+}
+
+TEST_CASE("SobolSequence", "[Math][Random]")
+{
+    SECTION("Every dimension is stratified")
+    {
+        Math::SobolSequence<f64> sobol;
+        f64 values[256];
+        for (SizeType dimension = 0; dimension < sobol.Dimensions; ++dimension)
+        {
+            sobol.Fill(0, dimension, values);
+            REQUIRE(IsStratified<f64>(values, 256));
+        }
+    }
+
+    SECTION("The first two dimensions form a (0, m, 2)-net")
+    {
+        Math::SobolSequence<f32> sobol(1234);
+        for (u32 log2x = 0; log2x <= 8; ++log2x)
+        {
+            u32 cellsX = u32(1) << log2x;
+            u32 cellsY = u32(256) / cellsX;
+            bool seen[256] = {};
+            for (SizeType i = 0; i < 256; ++i)
+            {
+                u32 x = Math::Cast<u32>(Math::Trunc<i32>(sobol.Sample(i, 0) * Math::Cast<f32>(cellsX)));
+                u32 y = Math::Cast<u32>(Math::Trunc<i32>(sobol.Sample(i, 1) * Math::Cast<f32>(cellsY)));
+                REQUIRE_FALSE(seen[ToUnderlying(y * cellsX + x)]);
+                seen[ToUnderlying(y * cellsX + x)] = true;
+            }
+        }
+    }
+
+    SECTION("Fill matches Sample")
+    {
+        Math::SobolSequence<f64> sobol(99);
+        f64 values[300];
+        sobol.Fill(1000, 5, values);
+        for (SizeType i = 0; i < 300; ++i)
+        {
+            REQUIRE(values[ToUnderlying(i)] == sobol.Sample(1000 + i, 5));
+        }
+    }
+
+    SECTION("Owen scrambling keeps stratification")
+    {
+        Math::SobolSequence<f64> sobol(7);
+        Math::SobolSequence<f64> plain;
+        f64 values[128];
+        sobol.Fill(0, 3, values);
+        REQUIRE(IsStratified<f64>(values, 128));
+        REQUIRE(sobol.Sample(0, 3) != plain.Sample(0, 3));
+    }
+}
+
+TEST_CASE("HaltonSequence", "[Math][Random]")
+{
+    SECTION("Radical inverse")
+    {
+        Math::HaltonSequence<f64> halton;
+        REQUIRE(Math::Equal(halton.Sample(1, 0), 0.5));
+        REQUIRE(Math::Equal(halton.Sample(6, 0), 0.375));
+        REQUIRE(Math::Equal(halton.Sample(1, 1), 1.0 / 3.0));
+        REQUIRE(Math::Equal(halton.Sample(5, 1), 7.0 / 9.0));
+        REQUIRE(Math::Equal(halton.Sample(3, 2), 0.6));
+    }
+
+    SECTION("Scrambled dimensions are stratified")
+    {
+        Math::Random64 rng(5);
+        Math::HaltonSequence<f64> halton(rng);
+        f64 values[243];
+        halton.Fill(0, 1, values);
+        REQUIRE(IsStratified<f64>(values, 243));
+        halton.Fill(0, 4, std::span<f64>(values, 121));
+        REQUIRE(IsStratified<f64>(std::span<const f64>(values, 121), 121));
+    }
+
+    SECTION("Fill matches Sample")
+    {
+        Math::Random32 rng(17);
+        Math::HaltonSequence<f32> halton(rng);
+        f32 values[500];
+        halton.Fill(12345, 7, values);
+        for (SizeType i = 0; i < 500; ++i)
+        {
+            REQUIRE(values[ToUnderlying(i)] == halton.Sample(12345 + i, 7));
+            REQUIRE(values[ToUnderlying(i)] < 1.0f);
+        }
+    }
+}
+
+TEST_CASE("RSequence", "[Math][Random]")
+{
+    SECTION("One dimension uses the golden ratio")
+    {
+        Math::RSequence<f64> r1(1, 0.0);
+        REQUIRE(Math::Equal(r1.Sample(1, 0), f64(0.6180339887498949), f64(1e-12)));
+        REQUIRE(Math::Equal(r1.Sample(2, 0), f64(0.2360679774997898), f64(1e-12)));
+    }
+
+    SECTION("Two dimensions use the plastic number")
+    {
+        Math::RSequence<f64> r2(2, 0.0);
+        REQUIRE(Math::Equal(r2.Sample(1, 0), f64(0.7548776662466927), f64(1e-12)));
+        REQUIRE(Math::Equal(r2.Sample(1, 1), f64(0.5698402909980532), f64(1e-12)));
+    }
+
+    SECTION("Fill matches Sample")
+    {
+        Math::RSequence<f32> r3(3);
+        f32 values[100];
+        r3.Fill(1u << 20, 2, values);
+        for (SizeType i = 0; i < 100; ++i)
+        {
+            REQUIRE(values[ToUnderlying(i)] == r3.Sample((1u << 20) + i, 2));
+        }
+    }
+}
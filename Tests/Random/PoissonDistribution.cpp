@@ -0,0 +1,79 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Random.hpp>
+
+using namespace Math::Types;
+using Math::Cast;
+
+namespace
+{
+    struct Moments
+    {
+        f64 Mean;
+        f64 Variance;
+    };
+
+    template <typename Dist, typename RNG>
+    Moments SampleMoments(const Dist& dist, RNG& rng, u32 count)
+    {
+        f64 sum = 0.0;
+        f64 sumSquares = 0.0;
+        for (u32 i = 0; i < count; ++i)
+        {
+            f64 sample = Cast<f64>(dist(rng));
+            sum += sample;
+            sumSquares += sample * sample;
+        }
+
+        f64 mean = sum / Cast<f64>(count);
+        return { mean, sumSquares / Cast<f64>(count) - mean * mean };
+    }
+}
+
+TEST_CASE("PoissonDistribution moments", "[Math][Random]")
+{
+    SECTION("Zero mean")
+    {
+        Math::Random64 rng(1);
+        Math::PoissonDistribution<u64> dist(0.0);
+        for (u32 i = 0; i < 100; ++i)
+        {
+            REQUIRE(dist(rng) == 0u);
+        }
+    }
+
+    SECTION("Small mean (inversion)")
+    {
+        Math::Random64 rng(2);
+        Math::PoissonDistribution<u64> dist(4.0);
+        Moments moments = SampleMoments(dist, rng, 50000);
+        REQUIRE(Math::Abs(moments.Mean - 4.0) < 0.05);
+        REQUIRE(Math::Abs(moments.Variance - 4.0) < 0.2);
+    }
+
+    SECTION("Mean just above the PTRS threshold")
+    {
+        Math::Random64 rng(3);
+        Math::PoissonDistribution<u64> dist(12.5);
+        Moments moments = SampleMoments(dist, rng, 50000);
+        REQUIRE(Math::Abs(moments.Mean - 12.5) < 0.1);
+        REQUIRE(Math::Abs(moments.Variance - 12.5) < 0.6);
+    }
+
+    SECTION("Large mean with f64")
+    {
+        Math::Random64 rng(4);
+        Math::PoissonDistribution<u64> dist(5000.0);
+        Moments moments = SampleMoments(dist, rng, 50000);
+        REQUIRE(Math::Abs(moments.Mean - 5000.0) < 2.0);
+        REQUIRE(Math::Abs(moments.Variance - 5000.0) < 250.0);
+    }
+
+    SECTION("Large mean with f32 (used to break above ~100)")
+    {
+        Math::Random32 rng(5);
+        Math::PoissonDistribution<u32> dist(2000.0f);
+        Moments moments = SampleMoments(dist, rng, 50000);
+        REQUIRE(Math::Abs(moments.Mean - 2000.0) < 1.5);
+        REQUIRE(Math::Abs(moments.Variance - 2000.0) < 100.0);
+    }
+}
@@ -0,0 +1,137 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Random.hpp>
+
+#include <span>
+
+using namespace Math::Types;
+using Math::ToUnderlying;
+
+TEST_CASE("Shuffle produces permutations", "[Math][Random]")
+{
+    SECTION("Every element is preserved")
+    {
+        Math::Random64 rng(42);
+        u32 values[100];
+        for (u32 i = 0; i < 100; ++i)
+        {
+            values[ToUnderlying(i)] = i;
+        }
+
+        Math::Shuffle(std::span<u32>(values), rng);
+
+        bool seen[100] = {};
+        for (u32 value : values)
+        {
+            REQUIRE(value < 100u);
+            REQUIRE_FALSE(seen[ToUnderlying(value)]);
+            seen[ToUnderlying(value)] = true;
+        }
+    }
+
+    SECTION("Empty and single element spans are left alone")
+    {
+        Math::Random32 rng(1);
+        u32 single[1] = { 7 };
+        Math::Shuffle(std::span<u32>(single, 0), rng);
+        Math::Shuffle(std::span<u32>(single), rng);
+        REQUIRE(single[0] == 7u);
+    }
+
+    SECTION("All permutations of three elements are equally likely")
+    {
+        // Note(3011): The old swap-with-any-index shuffle fails this, since it
+        // produces 27 equally likely swap sequences for only 6 permutations.
+        Math::Random64 rng(7);
+        u32 counts[6] = {};
+        constexpr u32 iterations = 60000;
+        for (u32 i = 0; i < iterations; ++i)
+        {
+            u32 values[3] = { 0, 1, 2 };
+            Math::Shuffle(std::span<u32>(values), rng);
+            u32 index = values[0] * 2 + (values[1] > values[2] ? 1 : 0);
+            ++counts[ToUnderlying(index)];
+        }
+
+        for (u32 count : counts)
+        {
+            REQUIRE(count > 9500u);
+            REQUIRE(count < 10500u);
+        }
+    }
+}
+
+TEST_CASE("SampleWithoutReplacement tests", "[Math][Random]")
+{
+    auto checkDistinct = [](std::span<const SizeType> sample, SizeType n)
+    {
+        for (SizeType i = 0; i < sample.size(); ++i)
+        {
+            REQUIRE(sample[ToUnderlying(i)] < n);
+            for (SizeType j = i + 1; j < sample.size(); ++j)
+            {
+                REQUIRE(sample[ToUnderlying(i)] != sample[ToUnderlying(j)]);
+            }
+        }
+    };
+
+    SECTION("Small sample from a large population (Floyd)")
+    {
+        Math::Random64 rng(3);
+        SizeType sample[8];
+        for (u32 i = 0; i < 100; ++i)
+        {
+            Math::SampleWithoutReplacement(std::span<SizeType>(sample), 1000, rng);
+            checkDistinct(sample, 1000);
+        }
+    }
+
+    SECTION("Large sample from a small population (selection)")
+    {
+        Math::Random32 rng(3);
+        SizeType sample[40];
+        for (u32 i = 0; i < 100; ++i)
+        {
+            Math::SampleWithoutReplacement(std::span<SizeType>(sample), 50, rng);
+            checkDistinct(sample, 50);
+        }
+    }
+
+    SECTION("Whole population")
+    {
+        Math::Random64 rng(11);
+        SizeType sample[16];
+        Math::SampleWithoutReplacement(std::span<SizeType>(sample), 16, rng);
+        checkDistinct(sample, 16);
+    }
+
+    SECTION("Sample larger than the population")
+    {
+        Math::Random64 rng(13);
+        SizeType sample[8] = { 99, 99, 99, 99, 99, 99, 99, 99 };
+        REQUIRE(Math::SampleWithoutReplacement(std::span<SizeType>(sample), 5, rng) == 5);
+        checkDistinct(std::span<const SizeType>(sample, 5), 5);
+        REQUIRE(sample[5] == 99);
+        REQUIRE(sample[7] == 99);
+    }
+
+    SECTION("Every index is picked equally often")
+    {
+        Math::Random64 rng(5);
+        u32 counts[10] = {};
+        SizeType sample[3];
+        for (u32 i = 0; i < 30000; ++i)
+        {
+            Math::SampleWithoutReplacement(std::span<SizeType>(sample), 10, rng);
+            for (SizeType index : sample)
+            {
+                ++counts[ToUnderlying(index)];
+            }
+        }
+
+        for (u32 count : counts)
+        {
+            REQUIRE(count > 8500u);
+            REQUIRE(count < 9500u);
+        }
+    }
+}
@@ -0,0 +1,157 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Functions.hpp>
+#include <Math/Random.hpp>
+
+#include <cmath>
+#include <span>
+
+using namespace Math::Types;
+using Math::Cast;
+using Math::ToUnderlying;
+
+namespace
+{
+    struct Moments
+    {
+        f64 Mean;
+        f64 Variance;
+    };
+
+    template <typename T>
+    Moments ComputeMoments(std::span<const T> samples)
+    {
+        f64 sum = 0.0;
+        f64 sumSquares = 0.0;
+        for (T sample : samples)
+        {
+            sum += Cast<f64>(sample);
+            sumSquares += Cast<f64>(sample) * Cast<f64>(sample);
+        }
+
+        f64 count = Cast<f64>(samples.size());
+        f64 mean = sum / count;
+        return { mean, sumSquares / count - mean * mean };
+    }
+
+    template <typename Distribution, typename RNG, typename T>
+    void Draw(const Distribution& dist, RNG& rng, std::span<T> samples)
+    {
+        for (T& sample : samples)
+        {
+            sample = dist(rng);
+        }
+    }
+
+    constexpr std::size_t sampleCount = 200000;
+}
+
+TEST_CASE("Ziggurat tables are generated correctly", "[Math][Random]")
+{
+    using Math::Implementation::NormalZiggurat;
+    using Math::Implementation::ExponentialZiggurat;
+
+    SECTION("Constexpr helpers")
+    {
+        STATIC_REQUIRE(Math::Implementation::ConstexprExp(0.0) == 1.0);
+        REQUIRE(Math::Equal(Math::Implementation::ConstexprExp(-3.25), f64(std::exp(-3.25)), f64(1e-15)));
+        REQUIRE(Math::Equal(Math::Implementation::ConstexprLog(1e-3), f64(std::log(1e-3)), f64(1e-13)));
+        REQUIRE(Math::Equal(Math::Implementation::ConstexprSqrt(7.0), f64(std::sqrt(7.0)), f64(1e-15)));
+    }
+
+    SECTION("Normal layers decrease towards the peak")
+    {
+        REQUIRE(Math::Equal(NormalZiggurat::sTables.F[0], 1.0));
+        for (SizeType i = 1; i < NormalZiggurat::Layers; ++i)
+        {
+            REQUIRE(NormalZiggurat::sTables.F[i] < NormalZiggurat::sTables.F[i - 1]);
+            REQUIRE(NormalZiggurat::sTables.W[i] > f64(0));
+        }
+        REQUIRE(Math::Equal(NormalZiggurat::sTables.F[NormalZiggurat::Layers - 1], f64(std::exp(-0.5 * 3.442619855899 * 3.442619855899)), f64(1e-12)));
+    }
+
+    SECTION("Exponential layers decrease towards the peak")
+    {
+        REQUIRE(Math::Equal(ExponentialZiggurat::sTables.F[0], 1.0));
+        for (SizeType i = 1; i < ExponentialZiggurat::Layers; ++i)
+        {
+            REQUIRE(ExponentialZiggurat::sTables.F[i] < ExponentialZiggurat::sTables.F[i - 1]);
+        }
+        // Note(3011): The top layer has to cover the same area as the others.
+        f64 x1 = ExponentialZiggurat::sTables.W[1] * 4294967296.0;
+        REQUIRE(Math::Equal(x1 * (1.0 - ExponentialZiggurat::sTables.F[1]), f64(3.949659822581572e-3), f64(1e-9)));
+    }
+}
+
+TEST_CASE("Ziggurat distribution moments", "[Math][Random]")
+{
+    SECTION("NormalDistribution f64")
+    {
+        Math::Random64 rng(1);
+        Math::NormalDistribution<f64> dist(2.0, 3.0);
+        static f64 samples[sampleCount];
+        Draw(dist, rng, std::span<f64>(samples));
+        Moments moments = ComputeMoments<f64>(samples);
+        REQUIRE(Math::Abs(moments.Mean - 2.0) < 0.03);
+        REQUIRE(Math::Abs(moments.Variance - 9.0) < 0.15);
+
+        u32 beyondThreeSigma = 0;
+        for (f64 sample : samples)
+        {
+            if (Math::Abs(sample - 2.0) > 9.0)
+            {
+                ++beyondThreeSigma;
+            }
+        }
+        // Note(3011): Expected about 0.27% of the samples, which checks the tail.
+        REQUIRE(beyondThreeSigma > 400u);
+        REQUIRE(beyondThreeSigma < 700u);
+    }
+
+    SECTION("NormalDistribution f32")
+    {
+        Math::Random32 rng(2);
+        Math::NormalDistribution<f32> dist;
+        static f32 samples[sampleCount];
+        Draw(dist, rng, std::span<f32>(samples));
+        Moments moments = ComputeMoments<f32>(samples);
+        REQUIRE(Math::Abs(moments.Mean) < 0.01);
+        REQUIRE(Math::Abs(moments.Variance - 1.0) < 0.02);
+    }
+
+    SECTION("ExponentialDistribution")
+    {
+        Math::Random64 rng(3);
+        Math::ExponentialDistribution<f64> dist(0.5);
+        static f64 samples[sampleCount];
+        Draw(dist, rng, std::span<f64>(samples));
+        Moments moments = ComputeMoments<f64>(samples);
+        REQUIRE(Math::Abs(moments.Mean - 2.0) < 0.03);
+        REQUIRE(Math::Abs(moments.Variance - 4.0) < 0.15);
+        for (f64 sample : samples)
+        {
+            REQUIRE(sample >= 0.0);
+        }
+    }
+
+    SECTION("GammaDistribution with shape above one")
+    {
+        Math::Random64 rng(4);
+        Math::GammaDistribution<f64> dist(3.5, 2.0);
+        static f64 samples[sampleCount];
+        Draw(dist, rng, std::span<f64>(samples));
+        Moments moments = ComputeMoments<f64>(samples);
+        REQUIRE(Math::Abs(moments.Mean - 7.0) < 0.05);
+        REQUIRE(Math::Abs(moments.Variance - 14.0) < 0.4);
+    }
+
+    SECTION("GammaDistribution with shape below one")
+    {
+        Math::Random32 rng(5);
+        Math::GammaDistribution<f32> dist(0.4f, 1.0f);
+        static f32 samples[sampleCount];
+        Draw(dist, rng, std::span<f32>(samples));
+        Moments moments = ComputeMoments<f32>(samples);
+        REQUIRE(Math::Abs(moments.Mean - 0.4) < 0.01);
+        REQUIRE(Math::Abs(moments.Variance - 0.4) < 0.03);
+    }
+}
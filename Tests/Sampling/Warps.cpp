@@ -0,0 +1,148 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Functions.hpp>
+#include <Math/Random.hpp>
+#include <Math/Sampling.hpp>
+
+#include <span>
+
+using namespace Math::Types;
+using Math::ToUnderlying;
+
+namespace
+{
+    constexpr std::size_t sampleCount = 4096;
+
+    // Note(3011): Integrating 1 / pdf over the warped samples has to give the
+    // measure of the target domain, as long as the PDF is non-zero on all of it.
+    template <typename Warp>
+    f64 EstimateMeasure(Warp warp)
+    {
+        Math::SobolSequence<f64> sobol(3);
+        f64 sum = 0.0;
+        for (std::size_t i = 0; i < sampleCount; ++i)
+        {
+            Math::Vector2d u(sobol.Sample(i, 0), sobol.Sample(i, 1));
+            sum += 1.0 / warp(u).PDF;
+        }
+        return sum / f64(sampleCount);
+    }
+}
+
+TEST_CASE("Warps", "[Math][Sampling]")
+{
+    using namespace Math::Sampling;
+
+    constexpr f64 tau = Math::Constant::Tau<f64>;
+
+    SECTION("Concentric disk")
+    {
+        REQUIRE(Math::Equal(ConcentricDisk(Math::Vector2d(0.5, 0.5)).Value.x, 0.0));
+        REQUIRE(Math::Equal(ConcentricDisk(Math::Vector2d(1.0, 0.5)).Value.x, 1.0));
+        REQUIRE(Math::Equal(ConcentricDisk(Math::Vector2d(0.5, 0.0)).Value.y, -1.0));
+        REQUIRE(Math::Equal(EstimateMeasure([](const Math::Vector2d& u) { return ConcentricDisk(u); }), Math::Constant::Pi<f64>, f64(1e-9)));
+    }
+
+    SECTION("Sphere and hemisphere directions")
+    {
+        Math::Random64 rng(9);
+        Math::UniformUnitDistribution<f64> dist;
+        for (int i = 0; i < 1000; ++i)
+        {
+            f64 u = dist(rng);
+            f64 v = dist(rng);
+            Math::Vector2d uv(u, v);
+
+            REQUIRE(Math::Equal(UniformSphere(uv).Value.Length(), 1.0, f64(1e-12)));
+            REQUIRE(UniformHemisphere(uv).Value.z >= 0.0);
+            REQUIRE(Math::Equal(UniformHemisphere(uv).Value.Length(), 1.0, f64(1e-12)));
+
+            Sample<Math::Vector3d, f64> cosine = CosineHemisphere(uv);
+            REQUIRE(cosine.Value.z >= 0.0);
+            REQUIRE(Math::Equal(cosine.Value.Length(), 1.0, f64(1e-12)));
+            REQUIRE(Math::Equal(cosine.PDF, CosineHemispherePDF(cosine.Value.z)));
+
+            Sample<Math::Vector3d, f64> cone = UniformCone(uv, f64(0.9));
+            REQUIRE(cone.Value.z >= 0.9 - 1e-12);
+            REQUIRE(Math::Equal(cone.Value.Length(), 1.0, f64(1e-12)));
+        }
+
+        REQUIRE(Math::Equal(EstimateMeasure([](const Math::Vector2d& u) { return UniformSphere(u); }), 2.0 * tau, f64(1e-9)));
+        REQUIRE(Math::Equal(EstimateMeasure([](const Math::Vector2d& u) { return UniformCone(u, f64(0.5)); }), 0.5 * tau, f64(1e-9)));
+    }
+
+    SECTION("Importance sampled lobes integrate to one")
+    {
+        REQUIRE(Math::Equal(EstimateMeasure([](const Math::Vector2d& u) { return CosineHemisphere(u); }), tau, f64(0.05)));
+        REQUIRE(Math::Equal(EstimateMeasure([](const Math::Vector2d& u) { return PhongLobe(u, f64(2.0)); }), tau, f64(0.05)));
+        REQUIRE(Math::Equal(EstimateMeasure([](const Math::Vector2d& u) { return GGX(u, f64(0.5)); }), tau, f64(0.05)));
+
+        Sample<Math::Vector3d, f64> phong = PhongLobe(Math::Vector2d(0.3, 0.7), f64(10.0));
+        REQUIRE(Math::Equal(phong.PDF, PhongLobePDF(phong.Value.z, f64(10.0))));
+        Sample<Math::Vector3d, f64> ggx = GGX(Math::Vector2d(0.3, 0.7), f64(0.2));
+        REQUIRE(Math::Equal(ggx.Value.Length(), 1.0, f64(1e-12)));
+        REQUIRE(Math::Equal(ggx.PDF, GGXPDF(ggx.Value.z, f64(0.2))));
+    }
+
+    SECTION("Triangle")
+    {
+        Math::Random64 rng(2);
+        Math::UniformUnitDistribution<f64> dist;
+        for (int i = 0; i < 1000; ++i)
+        {
+            f64 u = dist(rng);
+            f64 v = dist(rng);
+            Math::Vector2d barycentric = UniformTriangle(Math::Vector2d(u, v)).Value;
+            REQUIRE(barycentric.x >= 0.0);
+            REQUIRE(barycentric.y >= 0.0);
+            REQUIRE(barycentric.x + barycentric.y <= 1.0);
+        }
+
+        Math::Geometry::Triangle<f64> triangle({0.0, 0.0, 0.0}, {2.0, 0.0, 0.0}, {0.0, 3.0, 0.0});
+        Sample<Math::Point3d, f64> sample = UniformTriangle(triangle, Math::Vector2d(0.5, 0.5));
+        REQUIRE(Math::Equal(sample.PDF, 1.0 / 3.0));
+        REQUIRE(Math::Equal(sample.Value.z, 0.0));
+    }
+}
+
+TEST_CASE("Batched warps match the scalar ones", "[Math][Sampling]")
+{
+    using namespace Math::Sampling;
+
+    constexpr std::size_t count = 16;
+    f32 u[count];
+    f32 v[count];
+    Math::SobolSequence<f32> sobol(11);
+    sobol.Fill(0, 0, u);
+    sobol.Fill(0, 1, v);
+
+    f32 x[count];
+    f32 y[count];
+    f32 z[count];
+    f32 pdf[count];
+    UniformBatch<f32> in{u, v};
+    Sample3Batch<f32> out{x, y, z, pdf};
+
+    GGX(in, out, f32(0.3f));
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Sample<Math::Vector3f, f32> expected = GGX(Math::Vector2f(u[i], v[i]), f32(0.3f));
+        REQUIRE(x[i] == expected.Value.x);
+        REQUIRE(y[i] == expected.Value.y);
+        REQUIRE(z[i] == expected.Value.z);
+        REQUIRE(pdf[i] == expected.PDF);
+    }
+
+    Sample2Batch<f32> disk{x, y, pdf};
+    ConcentricDisk(in, disk);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Sample<Math::Vector2f, f32> expected = ConcentricDisk(Math::Vector2f(u[i], v[i]));
+        REQUIRE(x[i] == expected.Value.x);
+        REQUIRE(y[i] == expected.Value.y);
+    }
+
+    // Note(3011): Mismatched spans only process the common prefix.
+    z[4] = -1.0f;
+    CosineHemisphere(in, Sample3Batch<f32>{x, y, std::span<f32>(z, 4), pdf});
+    REQUIRE(z[4] == -1.0f);
+}
@@ -127,6 +127,27 @@ TEST_CASE("Test 3D LookAt transform")
     }
 }
 
+TEST_CASE("Test transform inverse", "[Math][Transform]")
+{
+    SECTION("2D")
+    {
+        Math::Transform2f t = Math::Translate(Math::Vector2f(1.0f, -2.0f)) * Math::Rotate(Math::f32(0.7f)) * Math::Scale(Math::Vector2f(2.0f, 0.5f));
+        Math::Transform2f inverse = Math::Invert(t);
+        REQUIRE(Math::Equal(inverse * (t * Math::Point2f(3.0f, 4.0f)), Math::Point2f(3.0f, 4.0f), 1e-5f));
+        REQUIRE(Math::Equal(t * (inverse * Math::Point2f(-1.0f, 0.5f)), Math::Point2f(-1.0f, 0.5f), 1e-5f));
+        REQUIRE(Math::Equal(inverse * (t * Math::Vector2f(3.0f, 4.0f)), Math::Vector2f(3.0f, 4.0f), 1e-5f));
+    }
+
+    SECTION("3D")
+    {
+        Math::Transform3f t = Math::Translate(Math::Vector3f(1.0f, -2.0f, 3.0f)) * Math::RotateY(Math::f32(0.7f)) * Math::RotateX(Math::f32(-1.3f)) * Math::Scale(Math::Vector3f(2.0f, 0.5f, -3.0f));
+        Math::Transform3f inverse = Math::Invert(t);
+        REQUIRE(Math::Equal(inverse * (t * Math::Point3f(3.0f, 4.0f, 5.0f)), Math::Point3f(3.0f, 4.0f, 5.0f), 1e-5f));
+        REQUIRE(Math::Equal(t * (inverse * Math::Point3f(-1.0f, 0.5f, 2.0f)), Math::Point3f(-1.0f, 0.5f, 2.0f), 1e-5f));
+        REQUIRE(Math::Equal(inverse * (t * Math::Vector3f(3.0f, 4.0f, 5.0f)), Math::Vector3f(3.0f, 4.0f, 5.0f), 1e-5f));
+    }
+}
+
 TEST_CASE("Test 3D projections")
 {
 